@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <field.hpp>
+#include <intx.h>
+#include <vector>
+
+using namespace intx;
+
+static const uint256 q = field::fr_params::modulus;
+
+static const int ITERATIONS = 1000000;
+static const int INV_ITERATIONS = 10000;
+
+// The signed extended Euclid that verifier.cpp used before Fr::inv().
+typedef struct int256_t
+{
+    uint256 value;
+    bool is_negative;
+} int256;
+
+static uint256
+modinv_euclid(uint256 a, uint256 b)
+{
+    if (b <= 1)
+        return 0;
+
+    uint256 b0 = b;
+    int256 x0 = { 0, false };
+    int256 x1 = { 1, false };
+
+    while (a > 1) {
+        if (b == 0)
+            return 0;
+        auto sd = sdivrem(a, b);
+        uint256 q = sd.quot;
+        uint256 t = b;
+        b = sd.rem;
+        a = t;
+
+        int256 t2 = x0;
+        uint256 qx0 = q * x0.value;
+        if (x0.is_negative != x1.is_negative) {
+            x0.value = x1.value + qx0;
+            x0.is_negative = x1.is_negative;
+        } else {
+            x0.value = (x1.value > qx0) ? x1.value - qx0 : qx0 - x1.value;
+            x0.is_negative =
+              (x1.value > qx0) ? x1.is_negative : !x0.is_negative;
+        }
+        x1 = t2;
+    }
+
+    return x1.is_negative ? (b0 - x1.value) : x1.value;
+}
+
+template<typename F>
+static double
+measure(F&& f, int iterations = ITERATIONS)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           iterations;
+}
+
+static void
+report(const char* name, double baseline, double montgomery)
+{
+    printf("%-8s intx %8.1f ns   Fr %8.1f ns   x%.1f\n",
+           name,
+           baseline,
+           montgomery,
+           baseline / montgomery);
+}
+
+int
+main()
+{
+    const uint256 a =
+      0x1e8e4e8d5c2b6c7a0d83d6a1f2b1c4e5d6f708192a3b4c5d6e7f8091a2b3c4d5_u256;
+    const uint256 b =
+      0x0f1e2d3c4b5a69788796a5b4c3d2e1f00112233445566778899aabbccddeeff0_u256;
+
+    // Every iteration depends on the previous one, so the numbers are
+    // latencies, which is what the serial MiMC and verifier chains see.
+    uint256 x = a;
+    Fr X = Fr::from_uint256(a);
+    const Fr B = Fr::from_uint256(b);
+
+    const double mul_intx = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            x = mulmod(x, b, q);
+    });
+    const double mul_fr = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            X = X * B;
+    });
+    if (X.to_uint256() != x) {
+        printf("mul mismatch\n");
+        return 1;
+    }
+    report("mul", mul_intx, mul_fr);
+
+    const double sqr_intx = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            x = mulmod(x, x, q);
+    });
+    const double sqr_fr = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            X = X.square();
+    });
+    if (X.to_uint256() != x) {
+        printf("square mismatch\n");
+        return 1;
+    }
+    report("square", sqr_intx, sqr_fr);
+
+    const double add_intx = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            x = addmod(x, b, q);
+    });
+    const double add_fr = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            X = X + B;
+    });
+    if (X.to_uint256() != x) {
+        printf("add mismatch\n");
+        return 1;
+    }
+    report("add", add_intx, add_fr);
+
+    const double sub_intx = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            x = addmod(x, q - b, q);
+    });
+    const double sub_fr = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            X = X - B;
+    });
+    if (X.to_uint256() != x) {
+        printf("sub mismatch\n");
+        return 1;
+    }
+    report("sub", sub_intx, sub_fr);
+
+    // Inverses feed back into the next input so that every call sees a
+    // fresh value; the +1 keeps the chain away from fixed points.
+    const double inv_intx = measure(
+      [&] {
+          for (int i = 0; i < INV_ITERATIONS; ++i)
+              x = addmod(modinv_euclid(x, q), 1, q);
+      },
+      INV_ITERATIONS);
+    const double inv_fr = measure(
+      [&] {
+          for (int i = 0; i < INV_ITERATIONS; ++i)
+              X = X.inv() + Fr::one();
+      },
+      INV_ITERATIONS);
+    if (X.to_uint256() != x) {
+        printf("inv mismatch\n");
+        return 1;
+    }
+    report("inv", inv_intx, inv_fr);
+
+    // Per element cost of inverting a batch of BATCH values one by one and
+    // with field::batch_inverse().
+    const int BATCH = 1024;
+    std::vector<Fr> values(BATCH);
+    for (int i = 0; i < BATCH; ++i)
+        values[i] = X + Fr::from_uint256(i);
+    std::vector<Fr> single = values;
+    std::vector<Fr> batch = values;
+    const double inv_single = measure(
+      [&] {
+          for (auto& v : single)
+              v = v.inv();
+      },
+      BATCH);
+    const double inv_batch = measure(
+      [&] { field::batch_inverse(batch); }, BATCH);
+    if (single != batch) {
+        printf("batch inverse mismatch\n");
+        return 1;
+    }
+    printf("batch    Fr::inv %6.1f ns   batch_inverse %6.1f ns per element\n",
+           inv_single,
+           inv_batch);
+
+    // An eight term linear combination, the shape of calculate_e(), with a
+    // reduction per term and with field::dot().
+    Fr lhs[8], rhs[8];
+    for (int i = 0; i < 8; ++i) {
+        lhs[i] = values[i];
+        rhs[i] = values[i + 8];
+    }
+    Fr sum_reduced, sum_lazy;
+    const double lc_reduced = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Fr s = Fr::zero();
+            for (int j = 0; j < 8; ++j)
+                s += lhs[j] * rhs[j];
+            lhs[0] = s;
+        }
+        sum_reduced = lhs[0];
+    });
+    lhs[0] = values[0];
+    const double lc_lazy = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            lhs[0] = field::dot(lhs, rhs, 8);
+        sum_lazy = lhs[0];
+    });
+    if (sum_reduced != sum_lazy) {
+        printf("dot mismatch\n");
+        return 1;
+    }
+    printf("dot8     reduced %6.1f ns   lazy %6.1f ns\n", lc_reduced, lc_lazy);
+
+    // Both multiplication kernels regardless of SEVERANCE_FIELD_LIMB_BITS.
+    // On a 64-bit host the 32-bit kernel is expected to be slower; it is
+    // the one the wasm build uses.
+    uint256 m64 = X.montgomery();
+    uint256 m32 = m64;
+    const double k64 = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            m64 = field::detail::mont_mul_64<field::fr_params>(
+              m64, B.montgomery());
+    });
+    const double k32 = measure([&] {
+        for (int i = 0; i < ITERATIONS; ++i)
+            m32 = field::detail::mont_mul_32<field::fr_params>(
+              m32, B.montgomery());
+    });
+    if (m64 != m32) {
+        printf("kernel mismatch\n");
+        return 1;
+    }
+    printf("kernels  64-bit %6.1f ns   32-bit %6.1f ns   (using %d-bit)\n",
+           k64,
+           k32,
+           SEVERANCE_FIELD_LIMB_BITS);
+
+    return 0;
+}
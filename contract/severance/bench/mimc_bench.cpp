@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <field.hpp>
+#include <mimcsponge.hpp>
+#include <thread>
+#include <vector>
+
+static const int HASHES = 100000;
+
+static const int RUNS = 5;
+
+// Best of RUNS, in ns per hash.
+template<typename F>
+static double
+measure(F&& f)
+{
+    double best = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        const double t =
+          std::chrono::duration<double, std::nano>(end - start).count();
+        if (run == 0 || t < best)
+            best = t;
+    }
+    return best / HASHES;
+}
+
+// Runs f(begin, end) over [0, HASHES) split across n_threads threads.
+template<typename F>
+static void
+parallel(unsigned n_threads, F&& f)
+{
+    std::vector<std::thread> threads;
+    const int chunk = (HASHES + n_threads - 1) / n_threads;
+    for (unsigned t = 0; t < n_threads; ++t) {
+        const int begin = t * chunk;
+        const int end = begin + chunk < HASHES ? begin + chunk : HASHES;
+        threads.emplace_back([&f, begin, end] { f(begin, end); });
+    }
+    for (auto& thread : threads)
+        thread.join();
+}
+
+static void
+report(const char* what, double ns)
+{
+    printf("%-12s %8.1f ns/hash %10.0f hashes/s\n", what, ns, 1e9 / ns);
+}
+
+int
+main()
+{
+    std::vector<Fr> a(HASHES), b(HASHES), k(HASHES);
+    Fr x = Fr::from_uint256(0x1234567890abcdef);
+    for (int i = 0; i < HASHES; ++i) {
+        x = x.square() + Fr::one();
+        a[i] = x;
+        b[i] = x + x;
+        k[i] = x.square();
+    }
+
+    std::vector<Fr> single(HASHES), batch(HASHES);
+    const double t_single = measure([&] {
+        for (int i = 0; i < HASHES; ++i)
+            single[i] = MiMC5Sponge::MiMC5Sponge(a[i], b[i], k[i]);
+    });
+    const double t_batch = measure([&] {
+        MiMC5Sponge::MiMC5Sponge(
+          a.data(), b.data(), k.data(), batch.data(), HASHES);
+    });
+    if (single != batch) {
+        printf("batch mismatch\n");
+        return 1;
+    }
+
+    report("single", t_single);
+    report("batch", t_batch);
+
+    const unsigned n_threads = std::thread::hardware_concurrency() > 0
+                                 ? std::thread::hardware_concurrency()
+                                 : 1;
+    std::vector<Fr> threaded(HASHES);
+    const double t_single_mt = measure([&] {
+        parallel(n_threads, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                threaded[i] = MiMC5Sponge::MiMC5Sponge(a[i], b[i], k[i]);
+        });
+    });
+    if (threaded != single) {
+        printf("threaded single mismatch\n");
+        return 1;
+    }
+    const double t_batch_mt = measure([&] {
+        parallel(n_threads, [&](int begin, int end) {
+            MiMC5Sponge::MiMC5Sponge(&a[begin],
+                                     &b[begin],
+                                     &k[begin],
+                                     &threaded[begin],
+                                     end - begin);
+        });
+    });
+    if (threaded != single) {
+        printf("threaded batch mismatch\n");
+        return 1;
+    }
+
+    char label[32];
+    snprintf(label, sizeof(label), "single x%u", n_threads);
+    report(label, t_single_mt);
+    snprintf(label, sizeof(label), "batch x%u", n_threads);
+    report(label, t_batch_mt);
+
+    return 0;
+}
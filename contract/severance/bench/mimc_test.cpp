@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Golden vectors for the MiMC sponge, generated with a reference
+// implementation of circomlib's MiMCSponge. The on-chain Merkle root has to
+// match the withdraw circuit bit for bit, so any change to the field or the
+// sponge code must keep this passing.
+
+#include <constants.hpp>
+#include <cstdio>
+#include <field.hpp>
+#include <intx.h>
+#include <merkle.hpp>
+#include <mimcsponge.hpp>
+
+using namespace intx;
+
+typedef struct
+{
+    uint256 a;
+    uint256 b;
+    uint256 k;
+    uint256 out;
+} vector_t;
+
+// MiMCSponge(2, 8, 1), the Merkle hash of circuits/withdraw.circom. The
+// inputs of the uint256 entry point are reduced mod q first.
+static const vector_t vectors_8[] = {
+    { 0_u256,
+      0_u256,
+      0_u256,
+      8186298191582837940772257395939180176740054521560084969910365466752188262660_u256 },
+    { 1_u256,
+      2_u256,
+      3_u256,
+      15277067287559239320178099985616274209372577316752469103207840768946242420691_u256 },
+    { 21888242871839275222246405745257275088548364400416034343698204186575808495616_u256,
+      21888242871839275222246405745257275088548364400416034343698204186575808495616_u256,
+      21888242871839275222246405745257275088548364400416034343698204186575808495616_u256,
+      3547336217561275635192223789377806563717440061035286703291265770590618646642_u256 },
+    { 21888242871839275222246405745257275088548364400416034343698204186575808495617_u256,
+      21888242871839275222246405745257275088548364400416034343698204186575808495618_u256,
+      21888242871839275222246405745257275088548364400416034343698204186575808495619_u256,
+      405328432509358645859331571816618987285303824696159566015006316783793415894_u256 },
+    { 115792089237316195423570985008687907853269984665640564039457584007913129639935_u256,
+      115792089237316195423570985008687907853269984665640564039457584007913129639935_u256,
+      115792089237316195423570985008687907853269984665640564039457584007913129639935_u256,
+      16940918654179840792319990752757811806245895890351943212948521411720396043951_u256 },
+    { 17693451527320800633076952754562902245065512901223315668685981998707441609684_u256,
+      18846054835596771335222070348146305067896459646658866051625944357291873451533_u256,
+      5153283709122863654931208036428839086731606164434618278695351634492117339023_u256,
+      21544811013218504176096843497944608722023631311257540117314736793658381188225_u256 },
+    { 6105777080497064170350560779387206086460397471284090324322527495991390628728_u256,
+      1126427652842912929062002605031053370881907461927544070637624495685892092246_u256,
+      9883070733713386227689840471677058935254989054814622655164817094747519133295_u256,
+      5604941128876793819147766228060505971058080114673707479628742291642793945771_u256 },
+    { 884536991625572465764926195919765426474468468756057902096225894107098768763_u256,
+      20846286812443116535445558672580992564980936826123900527680773420049255249152_u256,
+      11230787426233202243642312665108541626776454491815888288949065832155141190509_u256,
+      4446938242367666677340571091135880796220830606780315757026637646386212369472_u256 },
+    { 6126763363914612157903077331672206753319729935680366644302412093173325460291_u256,
+      3447853409095064755143293254827979460057299192804667397990554341706011954886_u256,
+      8510193612495950831303596708283285819064456909565991448112905024527329946629_u256,
+      15096737661873370438013502497883437142649535073499592632156713863347451742019_u256 },
+    { 19667325242628851181584694706410756772344098312538378966484068938997944555293_u256,
+      6573868367176013456935716069751351216568542889653385150270157341890231150347_u256,
+      7918251509593501149001057307839112635053226832913778707046843710799665134404_u256,
+      11970685731016192856093645441410368651876441034194531567113643917270833393751_u256 }
+};
+
+// MiMCSponge(2, 220, 1), the commitment hash of circuits/deposit.circom.
+static const vector_t vectors_220[] = {
+    { 0_u256,
+      0_u256,
+      0_u256,
+      20636625426020718969131298365984859231982649550971729229988535915544421356929_u256 },
+    { 1_u256,
+      2_u256,
+      3_u256,
+      20225509322021146255705869525264566735642015554514977326536820959638320229084_u256 },
+    { 20124938135465913781610109156156421509857858181715541576515943085921281073488_u256,
+      14763307180590960882606628423971081973628515401662365940932612425114523743240_u256,
+      12407194720319598592605850799054634927051369317579401656763085205365796992071_u256,
+      13576055430398424222542179766882508561442645529335737629200316172733957190322_u256 },
+    { 9096467360958076877502998854766067389270523748159318836743686305404905221971_u256,
+      13813093235481205649664167517751387571409157710732080937764794625128722963498_u256,
+      7136991397288726439446137912344304291330867408559771878021136112584865870196_u256,
+      11912817585219482982849043051580702297410006001493326862478330398383188706600_u256 }
+};
+
+// The deposit path of a commitment inserted at index 0 of an empty tree,
+// hashed with the commitment as the key against every entry of
+// level_defaults. path[MERKLE_HEIGHT - 1] is the root the contract stores.
+static const uint256 path_commitment =
+  10174727256153098277466436727837049203626706520442734328143207787941258246474_u256;
+
+static const uint256 path[32] = {
+    14258753840954978386935135242466501500852336336217173822396146309586037038971_u256,
+    10097174639221686804691771401915754316456146208056018974371137675476300883060_u256,
+    18590831741794371102023935192302992939618596532426140044699768794358130672652_u256,
+    19197305684249406429245358119843794410476997422352490524642983179305617292277_u256,
+    20634075007931253685822503549818184952076448330059435990814160460920862025337_u256,
+    5828822970693470573438431076290853805916048804789473558061570821827509360260_u256,
+    20035315767515227967102651778074178409004583667440326896997143475876618282605_u256,
+    9272588104126761861630386021317455593403861317115645266002236296826366309314_u256,
+    2491987434398704928303304055127171406479943065083772579274539170227727291058_u256,
+    11244846849872764878235652530893985438937787265488243352006505424167816292864_u256,
+    19945167204145901431520029396492168364364037204705910074877030120515605292055_u256,
+    6377670079193829585030876237163146177975761286813338121225863299116862701567_u256,
+    12590247845246107224391241665622039424444723134954134361251455485605258158271_u256,
+    15286749591439058782601940709541577834714483240126736741027256414904781314832_u256,
+    2955854585741414046166498145747974020348277734185279984912689302698143304026_u256,
+    20998090277629777605343343225576548553971475220544035081937098198563130074266_u256,
+    11878095656393846565306047872177746356370242187945104648703522120238783056338_u256,
+    15697726961585038345218305144854784037204769872047424894205448591748290792868_u256,
+    20074551544777255146959152110387286235899849126822146182237619143032636977167_u256,
+    1501952786161657967518985178421391654567915048412840132315107671604337699400_u256,
+    8335548645773304077592265045494355356294521364163976105436879797191613024544_u256,
+    9082895312595446469100092389819899724964605592077590387004714593959822238985_u256,
+    14489223937264570488672252461361171693956866431874431647905462480339799012396_u256,
+    2115110618597034348118902495450793059681804049155426556643540157725167415905_u256,
+    19881232295967902781489895290807924443414538117233462945638381499678059615470_u256,
+    11251042541471138746736822233846425613724801173594971637728996358613725528766_u256,
+    7924954606970756010737287426957648730191398777409810541121148198253736565744_u256,
+    2571777456584806130626656844556951254888691888647116902860617079148525698242_u256,
+    2995431377330125190449339617427154947216545079973456600718818010082798938770_u256,
+    2103210830308076981019586780852814822097936483545730408693151634260238454604_u256,
+    21254654642352243353816908183988240116222491448927180967070729526527450086817_u256,
+    6687174024595608635072621075613674358422771914249747659349288224814610583046_u256
+};
+
+static int failures = 0;
+
+static void
+expect(const char* what, int i, const uint256& got, const uint256& want)
+{
+    if (got == want)
+        return;
+    printf("FAIL %s[%d]\n  got  %s\n  want %s\n",
+           what,
+           i,
+           to_string(got).c_str(),
+           to_string(want).c_str());
+    failures++;
+}
+
+template<typename Sponge, int N>
+static void
+check_vectors(const char* what, const vector_t (&vectors)[N])
+{
+    for (int i = 0; i < N; i++) {
+        const vector_t& v = vectors[i];
+        const Sponge sponge(Fr::from_uint256(v.k));
+        const Fr out =
+          sponge.hash(Fr::from_uint256(v.a), Fr::from_uint256(v.b));
+        expect(what, i, out.to_uint256(), v.out);
+    }
+}
+
+static void
+check_entry_points()
+{
+    const int n = sizeof(vectors_8) / sizeof(vectors_8[0]);
+    Fr a[n], b[n], k[n], out[n];
+
+    for (int i = 0; i < n; i++) {
+        const vector_t& v = vectors_8[i];
+        expect("uint256", i, MiMC5Sponge::MiMC5Sponge(v.a, v.b, v.k), v.out);
+
+        a[i] = Fr::from_uint256(v.a);
+        b[i] = Fr::from_uint256(v.b);
+        k[i] = Fr::from_uint256(v.k);
+        const Fr out_fr = MiMC5Sponge::MiMC5Sponge(a[i], b[i], k[i]);
+        expect("Fr", i, out_fr.to_uint256(), v.out);
+    }
+
+    // Every batch length up to n, so both the lane groups and the tail run.
+    for (int count = 1; count <= n; count++) {
+        MiMC5Sponge::MiMC5Sponge(a, b, k, out, count);
+        for (int i = 0; i < count; i++)
+            expect("batch",
+                   count * 100 + i,
+                   out[i].to_uint256(),
+                   vectors_8[i].out);
+    }
+}
+
+static void
+check_path()
+{
+    const Fr commitment = Fr::from_uint256(path_commitment);
+    const MiMC5Sponge::keyed_sponge mimc(commitment);
+
+    Fr current_hash = commitment;
+    for (int i = 0; i < 32; i++) {
+        current_hash =
+          mimc.hash(current_hash, Fr::from_uint256(level_defaults[i]));
+        expect("path", i, current_hash.to_uint256(), path[i]);
+    }
+
+    // The same root through the contract's Merkle insertion.
+    Fr last_level_hash[MERKLE_HEIGHT];
+    const Fr root = merkle_insert(
+      commitment,
+      0,
+      [&](int level) { return last_level_hash[level]; },
+      [&](int level, const Fr& hash) { last_level_hash[level] = hash; });
+    expect("merkle_insert", 0, root.to_uint256(), path[MERKLE_HEIGHT - 1]);
+}
+
+int
+main()
+{
+    check_vectors<MiMC5Sponge::keyed_sponge>("sponge_8", vectors_8);
+    check_vectors<MiMC5Sponge::deposit_sponge>("sponge_220", vectors_220);
+    check_entry_points();
+    check_path();
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("all vectors pass\n");
+    return 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the FFLONK verifier against a proof made by snarkjs for
+// circuits/withdraw.circom, rather than by the test prover, which follows
+// the same reading of snarkjs as the verifier and so cannot catch a
+// mismatch with it:
+//
+//   fflonk_snarkjs_test dir
+//
+// reads dir/proof.json and dir/public.json, as written by 'snarkjs fflonk
+// prove'. The verifier has to be built with the key of the same zkey, see
+// host/CMakeLists.txt.
+//
+// Without a directory it writes a test prover's proof the way snarkjs does
+// and reads it back, which checks the reading only. That is fflonk_json_test,
+// the same checks built with the test key.
+
+#include <constants.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fflonk_verifier.hpp>
+#include <intx.h>
+#include <json.hpp>
+#include <string>
+#include <test_fflonk_prover.hpp>
+#include <test_prover.hpp>
+#include <utility>
+
+using namespace intx;
+
+static int failures = 0;
+
+static void
+expect(bool ok, const char* what)
+{
+    if (ok)
+        return;
+    printf("FAIL %s\n", what);
+    failures++;
+}
+
+// The names snarkjs gives the parts of a proof.
+static const std::pair<const char*, std::array<char, 64> fflonk_proof::*>
+  polynomials[] = {
+      { "C1", &fflonk_proof::C1 },
+      { "C2", &fflonk_proof::C2 },
+      { "W1", &fflonk_proof::W1 },
+      { "W2", &fflonk_proof::W2 },
+  };
+
+static const std::pair<const char*, std::array<char, 32> fflonk_proof::*>
+  evaluations[] = {
+      { "ql", &fflonk_proof::eval_ql },   { "qr", &fflonk_proof::eval_qr },
+      { "qm", &fflonk_proof::eval_qm },   { "qo", &fflonk_proof::eval_qo },
+      { "qc", &fflonk_proof::eval_qc },   { "s1", &fflonk_proof::eval_s1 },
+      { "s2", &fflonk_proof::eval_s2 },   { "s3", &fflonk_proof::eval_s3 },
+      { "a", &fflonk_proof::eval_a },     { "b", &fflonk_proof::eval_b },
+      { "c", &fflonk_proof::eval_c },     { "z", &fflonk_proof::eval_z },
+      { "zw", &fflonk_proof::eval_zw },   { "t1w", &fflonk_proof::eval_t1w },
+      { "t2w", &fflonk_proof::eval_t2w }, { "inv", &fflonk_proof::eval_inv },
+  };
+
+static void
+store(char* out, const json& v)
+{
+    be::unsafe::store((uint8_t*)out, from_string<uint256>(v.text));
+}
+
+static std::string
+number(const char* in)
+{
+    return "\"" + to_string(be::unsafe::load<uint256>((const uint8_t*)in)) +
+           "\"";
+}
+
+static fflonk_proof
+read_proof(const json& j)
+{
+    if (j["protocol"].text != "fflonk")
+        throw std::runtime_error("not an fflonk proof");
+
+    fflonk_proof proof;
+    for (const auto& p : polynomials) {
+        const json& point = j["polynomials"][p.first];
+        if (point[2].text != "1")
+            throw std::runtime_error(std::string("affine ") + p.first);
+        store((proof.*p.second).data(), point[0]);
+        store((proof.*p.second).data() + 32, point[1]);
+    }
+    for (const auto& e : evaluations)
+        store((proof.*e.second).data(), j["evaluations"][e.first]);
+    return proof;
+}
+
+static withdraw_inputs
+read_inputs(const json& j)
+{
+    if (j.items.size() != PUBLIC)
+        throw std::runtime_error("wrong number of public inputs");
+    withdraw_inputs inputs;
+    for (int i = 0; i < PUBLIC; ++i)
+        store((char*)&inputs + 32 * i, j[i]);
+    return inputs;
+}
+
+static std::string
+write_proof(const fflonk_proof& proof)
+{
+    std::string r = "{\"polynomials\": {";
+    for (const auto& p : polynomials) {
+        const char* point = (proof.*p.second).data();
+        r += std::string(p.first == polynomials[0].first ? "" : ", ") + "\"" +
+             p.first + "\": [" + number(point) + ", " + number(point + 32) +
+             ", \"1\"]";
+    }
+    r += "}, \"evaluations\": {";
+    for (const auto& e : evaluations) {
+        r += std::string(e.first == evaluations[0].first ? "" : ", ") + "\"" +
+             e.first + "\": " + number((proof.*e.second).data());
+    }
+    return r + "}, \"protocol\": \"fflonk\", \"curve\": \"bn128\"}";
+}
+
+static std::string
+write_inputs(const withdraw_inputs& inputs)
+{
+    std::string r = "[";
+    for (int i = 0; i < PUBLIC; ++i)
+        r += std::string(i ? ", " : "") + number(inputs[i].data());
+    return r + "]";
+}
+
+static void
+check(const fflonk_proof& proof, const withdraw_inputs& inputs)
+{
+    expect(isWellFormedFflonkProof(proof), "well formed proof");
+    expect(isValidFflonkProof(proof, inputs), "valid proof");
+
+    auto other_inputs = inputs;
+    other_inputs.nullifier_hash[31] ^= 1;
+    expect(!isValidFflonkProof(proof, other_inputs),
+           "proof for other public inputs");
+
+    for (const auto& e : evaluations) {
+        if (e.second == &fflonk_proof::eval_inv)
+            continue;
+        auto bad_eval = proof;
+        (bad_eval.*e.second)[31] ^= 1;
+        expect(!isValidFflonkProof(bad_eval, inputs),
+               "proof with a wrong evaluation");
+    }
+
+    // snarkjs computes inv after its last challenge and does not hash it,
+    // so it cannot steer the transcript, and the verifier computes its own
+    // inverses instead of trusting it.
+    auto other_inv = proof;
+    other_inv.eval_inv[31] ^= 1;
+    expect(isValidFflonkProof(other_inv, inputs),
+           "proof with another inverse hint");
+}
+
+// A test prover's proof through write_proof and read_proof, and checked.
+static void
+check_round_trip()
+{
+    test_vk::prover input_source(1);
+    std::vector<std::vector<char>> input_data;
+    for (int i = 0; i < PUBLIC; ++i)
+        input_data.push_back(input_source.random_input());
+    const withdraw_inputs inputs = test_vk::to_withdraw_inputs(input_data);
+    const fflonk_proof proof = test_vk::fflonk_prover(1).prove(inputs);
+
+    const fflonk_proof read =
+      read_proof(json_parser(write_proof(proof)).parse());
+    const withdraw_inputs read_in =
+      read_inputs(json_parser(write_inputs(inputs)).parse());
+    expect(memcmp(&read, &proof, sizeof(proof)) == 0, "proof read back");
+    expect(memcmp(&read_in, &inputs, sizeof(inputs)) == 0, "inputs read back");
+    check(read, read_in);
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [dir]\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        if (argc == 2) {
+            const std::string dir = argv[1];
+            check(read_proof(read_json(dir + "/proof.json")),
+                  read_inputs(read_json(dir + "/public.json")));
+        } else {
+            check_round_trip();
+        }
+    } catch (const std::exception& e) {
+        fprintf(stderr, "fflonk_snarkjs_test: %s\n", e.what());
+        return 1;
+    }
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("all checks pass\n");
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host stand-in for the CDT check.hpp.
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace eosio {
+
+// Thrown where the chain would abort the transaction.
+struct check_failure : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+
+inline void
+check(bool pred, const char* msg)
+{
+    if (!pred)
+        throw check_failure(msg);
+}
+
+inline void
+check(bool pred, const std::string& msg)
+{
+    if (!pred)
+        throw check_failure(msg);
+}
+
+} // namespace eosio
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host stand-in for the CDT crypto.hpp: only the checksum type the
+// contract core uses.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace eosio {
+
+class checksum256
+{
+  public:
+    checksum256() { bytes.fill(0); }
+
+    explicit checksum256(const std::array<uint8_t, 32>& b)
+      : bytes(b)
+    {
+    }
+
+    std::array<uint8_t, 32> extract_as_byte_array() const { return bytes; }
+
+    const uint8_t* data() const { return bytes.data(); }
+
+    friend bool operator==(const checksum256& a, const checksum256& b)
+    {
+        return a.bytes == b.bytes;
+    }
+
+    friend bool operator!=(const checksum256& a, const checksum256& b)
+    {
+        return a.bytes != b.bytes;
+    }
+
+  private:
+    std::array<uint8_t, 32> bytes;
+};
+
+} // namespace eosio
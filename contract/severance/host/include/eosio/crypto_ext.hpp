@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host stand-in for the CDT 4.0 crypto_ext.hpp. The declarations mirror the
+// CDT ones, raw pointer entry points included, and are implemented in
+// software by host/src/alt_bn128.cpp and host/src/keccak.cpp. Results follow
+// the nodeos host functions: 0 on success, -1 on malformed input, and for
+// alt_bn128_pair 1 when the pairing product is not the identity.
+
+#pragma once
+
+#include <cstdint>
+#include <eosio/check.hpp>
+#include <eosio/crypto.hpp>
+#include <utility>
+#include <vector>
+
+namespace eosio {
+
+using bigint = std::vector<char>;
+
+struct g1_point
+{
+    std::vector<char> x;
+    std::vector<char> y;
+
+    g1_point(std::vector<char> x_, std::vector<char> y_)
+      : x(std::move(x_))
+      , y(std::move(y_))
+    {
+    }
+
+    // 64 bytes, x then y, big endian.
+    explicit g1_point(const char* raw)
+      : x(raw, raw + 32)
+      , y(raw + 32, raw + 64)
+    {
+    }
+
+    std::vector<char> serialized() const
+    {
+        std::vector<char> r(x);
+        r.insert(r.end(), y.begin(), y.end());
+        return r;
+    }
+};
+
+struct g2_point
+{
+    std::vector<char> x;
+    std::vector<char> y;
+
+    g2_point(std::vector<char> x_, std::vector<char> y_)
+      : x(std::move(x_))
+      , y(std::move(y_))
+    {
+    }
+
+    // 128 bytes, x then y, each as the imaginary then the real part.
+    explicit g2_point(const char* raw)
+      : x(raw, raw + 64)
+      , y(raw + 64, raw + 128)
+    {
+    }
+
+    std::vector<char> serialized() const
+    {
+        std::vector<char> r(x);
+        r.insert(r.end(), y.begin(), y.end());
+        return r;
+    }
+};
+
+int32_t
+alt_bn128_add(const char* op1,
+              uint32_t op1_len,
+              const char* op2,
+              uint32_t op2_len,
+              char* result,
+              uint32_t result_len);
+
+int32_t
+alt_bn128_mul(const char* g1,
+              uint32_t g1_len,
+              const char* scalar,
+              uint32_t scalar_len,
+              char* result,
+              uint32_t result_len);
+
+int32_t
+alt_bn128_pair(const char* pairs, uint32_t pairs_len);
+
+checksum256
+keccak(const char* data, uint32_t length);
+
+template<typename T>
+g1_point
+alt_bn128_add(const T& op1, const T& op2)
+{
+    const auto a = op1.serialized();
+    const auto b = op2.serialized();
+    char result[64];
+    const int32_t ret = alt_bn128_add(
+      a.data(), a.size(), b.data(), b.size(), result, sizeof(result));
+    check(ret == 0, "alt_bn128_add error");
+    return g1_point(result);
+}
+
+template<typename T>
+g1_point
+alt_bn128_mul(const T& g1, const bigint& scalar)
+{
+    const auto p = g1.serialized();
+    char result[64];
+    const int32_t ret = alt_bn128_mul(p.data(),
+                                      p.size(),
+                                      scalar.data(),
+                                      scalar.size(),
+                                      result,
+                                      sizeof(result));
+    check(ret == 0, "alt_bn128_mul error");
+    return g1_point(result);
+}
+
+template<typename G1_T, typename G2_T>
+int32_t
+alt_bn128_pair(const std::vector<std::pair<G1_T, G2_T>>& pairs)
+{
+    std::vector<char> buffer;
+    buffer.reserve(pairs.size() * 192);
+    for (const auto& pair : pairs) {
+        const auto a = pair.first.serialized();
+        const auto b = pair.second.serialized();
+        buffer.insert(buffer.end(), a.begin(), a.end());
+        buffer.insert(buffer.end(), b.begin(), b.end());
+    }
+    return alt_bn128_pair(buffer.data(), buffer.size());
+}
+
+} // namespace eosio
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host stand-in for the subset of the CDT eosio.hpp used by the contract
+// core, so it can be built and profiled with the native toolchain.
+
+#pragma once
+
+#include <cstdint>
+#include <eosio/check.hpp>
+#include <eosio/crypto.hpp>
+#include <eosio/crypto_ext.hpp>
+#include <iostream>
+#include <string>
+
+namespace eosio {
+
+template<typename... Args>
+void
+print(Args&&... args)
+{
+    (std::cout << ... << args);
+}
+
+struct name
+{
+    uint64_t value = 0;
+
+    constexpr name() = default;
+    constexpr explicit name(uint64_t v)
+      : value(v)
+    {
+    }
+
+    friend constexpr bool operator==(const name& a, const name& b)
+    {
+        return a.value == b.value;
+    }
+};
+
+} // namespace eosio
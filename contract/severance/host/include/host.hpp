@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Helpers of the native build that have no host function counterpart.
+
+#pragma once
+
+#include <cstddef>
+#include <eosio/crypto.hpp>
+#include <eosio/crypto_ext.hpp>
+#include <intx.h>
+
+namespace host {
+
+// Number of host function calls made so far, for the benchmarks.
+typedef struct
+{
+    uint64_t alt_bn128_add;
+    uint64_t alt_bn128_mul;
+    uint64_t alt_bn128_pair;
+    uint64_t keccak;
+} call_counts_t;
+
+extern call_counts_t call_counts;
+
+// Keccak-256 that is fed incrementally, the native transcript backend (see
+// transcript.hpp). finish() counts as one keccak call.
+class keccak_sponge
+{
+  public:
+    void absorb(const void* data, std::size_t size);
+    eosio::checksum256 finish();
+
+  private:
+    uint64_t state[25] = {};
+    uint8_t block[136];
+    std::size_t length = 0;
+};
+
+// The points of the given coordinates, as the eosio types, for the tests.
+eosio::g1_point
+make_g1_point(const intx::uint256& x, const intx::uint256& y);
+eosio::g2_point
+make_g2_point(const intx::uint256& x1,
+              const intx::uint256& x2,
+              const intx::uint256& y1,
+              const intx::uint256& y2);
+
+// s * q on the G2 twist, used to derive test verification keys.
+eosio::g2_point
+g2_mul(const eosio::g2_point& q, const intx::uint256& s);
+
+} // namespace host
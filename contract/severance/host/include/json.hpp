@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// The JSON reader of vk_gen and fflonk_snarkjs_test.
+
+#pragma once
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Just enough JSON for snarkjs keys and proofs: numbers are kept as their text, as the
+// big ones are strings anyway.
+struct json
+{
+    std::string text;
+    std::vector<json> items;
+    std::map<std::string, json> fields;
+
+    const json& operator[](const std::string& key) const
+    {
+        auto it = fields.find(key);
+        if (it == fields.end())
+            throw std::runtime_error("missing " + key);
+        return it->second;
+    }
+
+    const json& operator[](size_t i) const
+    {
+        if (i >= items.size())
+            throw std::runtime_error("short array");
+        return items[i];
+    }
+};
+
+class json_parser
+{
+  public:
+    explicit json_parser(const std::string& s)
+      : s(s)
+    {}
+
+    json parse()
+    {
+        json v = value();
+        skip();
+        if (pos != s.size())
+            fail();
+        return v;
+    }
+
+  private:
+    const std::string& s;
+    size_t pos = 0;
+
+    [[noreturn]] void fail()
+    {
+        throw std::runtime_error("bad json at " + std::to_string(pos));
+    }
+
+    void skip()
+    {
+        while (pos < s.size() && isspace((unsigned char)s[pos]))
+            ++pos;
+    }
+
+    bool next(char c)
+    {
+        skip();
+        if (pos < s.size() && s[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    std::string string()
+    {
+        if (!next('"'))
+            fail();
+        std::string r;
+        while (pos < s.size() && s[pos] != '"') {
+            if (s[pos] == '\\')
+                ++pos;
+            r += s[pos++];
+        }
+        if (pos++ == s.size())
+            fail();
+        return r;
+    }
+
+    json value()
+    {
+        json v;
+        skip();
+        if (next('{')) {
+            if (next('}'))
+                return v;
+            do {
+                const std::string key = string();
+                if (!next(':'))
+                    fail();
+                v.fields[key] = value();
+            } while (next(','));
+            if (!next('}'))
+                fail();
+        } else if (next('[')) {
+            if (next(']'))
+                return v;
+            do {
+                v.items.push_back(value());
+            } while (next(','));
+            if (!next(']'))
+                fail();
+        } else if (pos < s.size() && s[pos] == '"') {
+            v.text = string();
+        } else {
+            while (pos < s.size() && strchr(",]} \t\r\n", s[pos]) == nullptr)
+                v.text += s[pos++];
+            if (v.text.empty())
+                fail();
+        }
+        return v;
+    }
+};
+
+// The JSON file at path, parsed.
+inline json
+read_json(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in)
+        throw std::runtime_error("cannot read " + path);
+    std::stringstream text;
+    text << in.rdbuf();
+    return json_parser(text.str()).parse();
+}
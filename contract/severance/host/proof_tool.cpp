@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Converts withdraw proofs between the uncompressed layout of 'withdraw' and
+// the compressed one of 'withdrawc', for relayers. Reads the proof as hex
+// from stdin and writes the other layout as hex to stdout.
+//
+//   proof_tool compress   < proof.hex
+//   proof_tool decompress < proof.hex
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <verifier.hpp>
+
+static bool
+from_hex(const std::string& hex, char* out, size_t size)
+{
+    if (hex.size() != 2 * size)
+        return false;
+    for (size_t i = 0; i < size; ++i) {
+        unsigned int byte;
+        if (sscanf(hex.c_str() + 2 * i, "%2x", &byte) != 1)
+            return false;
+        out[i] = (char)byte;
+    }
+    return true;
+}
+
+static void
+print_hex(const void* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+        printf("%02x", ((const uint8_t*)data)[i]);
+    printf("\n");
+}
+
+int
+main(int argc, char** argv)
+{
+    const bool compress = argc == 2 && strcmp(argv[1], "compress") == 0;
+    const bool decompress = argc == 2 && strcmp(argv[1], "decompress") == 0;
+    if (!compress && !decompress) {
+        fprintf(stderr, "usage: %s compress|decompress < proof.hex\n", argv[0]);
+        return 2;
+    }
+
+    std::string hex;
+    std::cin >> hex;
+    if (hex.compare(0, 2, "0x") == 0)
+        hex.erase(0, 2);
+
+    if (compress) {
+        withdraw_proof proof;
+        if (!from_hex(hex, (char*)&proof, sizeof(proof))) {
+            fprintf(stderr, "expected %zu bytes as hex\n", sizeof(proof));
+            return 1;
+        }
+        const withdraw_proof_compressed data = compress_proof(proof);
+        print_hex(&data, sizeof(data));
+    } else {
+        withdraw_proof_compressed data;
+        if (!from_hex(hex, (char*)&data, sizeof(data))) {
+            fprintf(stderr, "expected %zu bytes as hex\n", sizeof(data));
+            return 1;
+        }
+        withdraw_proof proof;
+        if (!decompress_proof(data, proof)) {
+            fprintf(stderr, "a point is not on the curve\n");
+            return 1;
+        }
+        print_hex(&proof, sizeof(proof));
+    }
+    return 0;
+}
@@ -0,0 +1,594 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Software alt_bn128 (BN254) for the native build: G1 addition and scalar
+// multiplication, and the optimal ate pairing check of EIP-197.
+//
+// This is a reference stand-in for the nodeos host functions, written for
+// clarity over speed. It validates that points are on their curve but, unlike
+// nodeos, does not check G2 subgroup membership.
+
+#include <eosio/crypto_ext.hpp>
+#include <field.hpp>
+#include <host.hpp>
+#include <intx.h>
+
+using namespace intx;
+
+namespace {
+
+// Fq2 = Fq[u] / (u^2 + 1)
+struct fq2
+{
+    Fq c0, c1;
+
+    static fq2 zero() { return fq2(); }
+    static fq2 one() { return { Fq::one(), Fq::zero() }; }
+
+    bool is_zero() const { return c0.is_zero() && c1.is_zero(); }
+
+    fq2 conj() const { return { c0, -c1 }; }
+
+    fq2 operator+(const fq2& b) const { return { c0 + b.c0, c1 + b.c1 }; }
+    fq2 operator-(const fq2& b) const { return { c0 - b.c0, c1 - b.c1 }; }
+    fq2 operator-() const { return { -c0, -c1 }; }
+
+    fq2 operator*(const fq2& b) const
+    {
+        const Fq t0 = c0 * b.c0;
+        const Fq t1 = c1 * b.c1;
+        return { t0 - t1, (c0 + c1) * (b.c0 + b.c1) - t0 - t1 };
+    }
+
+    fq2 operator*(const Fq& b) const { return { c0 * b, c1 * b }; }
+
+    fq2 square() const { return *this * *this; }
+
+    fq2 inv() const
+    {
+        const Fq n = (c0.square() + c1.square()).inv();
+        return { c0 * n, -c1 * n };
+    }
+
+    // Multiplication by xi = 9 + u, the non-residue of the tower.
+    fq2 mul_by_xi() const
+    {
+        const Fq nine = Fq::from_uint256(9);
+        return { c0 * nine - c1, c0 + c1 * nine };
+    }
+
+    fq2 pow(const uint256& e) const
+    {
+        fq2 r = one();
+        for (int i = 255; i >= 0; --i) {
+            r = r.square();
+            if ((e[i / 64] >> (i % 64)) & 1)
+                r = r * *this;
+        }
+        return r;
+    }
+
+    bool operator==(const fq2& b) const { return c0 == b.c0 && c1 == b.c1; }
+};
+
+// Fq6 = Fq2[v] / (v^3 - xi)
+struct fq6
+{
+    fq2 c0, c1, c2;
+
+    static fq6 zero() { return fq6(); }
+    static fq6 one() { return { fq2::one(), fq2(), fq2() }; }
+
+    fq6 operator+(const fq6& b) const
+    {
+        return { c0 + b.c0, c1 + b.c1, c2 + b.c2 };
+    }
+
+    fq6 operator-(const fq6& b) const
+    {
+        return { c0 - b.c0, c1 - b.c1, c2 - b.c2 };
+    }
+
+    fq6 operator-() const { return { -c0, -c1, -c2 }; }
+
+    fq6 operator*(const fq6& b) const
+    {
+        const fq2 t0 = c0 * b.c0;
+        const fq2 t1 = c1 * b.c1;
+        const fq2 t2 = c2 * b.c2;
+        return { t0 + ((c1 + c2) * (b.c1 + b.c2) - t1 - t2).mul_by_xi(),
+                 (c0 + c1) * (b.c0 + b.c1) - t0 - t1 + t2.mul_by_xi(),
+                 (c0 + c2) * (b.c0 + b.c2) - t0 - t2 + t1 };
+    }
+
+    fq6 mul_by_v() const { return { c2.mul_by_xi(), c0, c1 }; }
+
+    fq6 inv() const
+    {
+        const fq2 a = c0.square() - (c1 * c2).mul_by_xi();
+        const fq2 b = c2.square().mul_by_xi() - c0 * c1;
+        const fq2 c = c1.square() - c0 * c2;
+        const fq2 f = (c0 * a + (c2 * b + c1 * c).mul_by_xi()).inv();
+        return { a * f, b * f, c * f };
+    }
+
+    bool operator==(const fq6& b) const
+    {
+        return c0 == b.c0 && c1 == b.c1 && c2 == b.c2;
+    }
+};
+
+// Fq12 = Fq6[w] / (w^2 - v)
+struct fq12
+{
+    fq6 c0, c1;
+
+    static fq12 one() { return { fq6::one(), fq6() }; }
+
+    fq12 operator*(const fq12& b) const
+    {
+        const fq6 t0 = c0 * b.c0;
+        const fq6 t1 = c1 * b.c1;
+        return { t0 + t1.mul_by_v(), (c0 + c1) * (b.c0 + b.c1) - t0 - t1 };
+    }
+
+    fq12 square() const { return *this * *this; }
+
+    // The p^6 Frobenius.
+    fq12 conj() const { return { c0, -c1 }; }
+
+    fq12 inv() const
+    {
+        const fq6 n = (c0 * c0 - (c1 * c1).mul_by_v()).inv();
+        return { c0 * n, -(c1 * n) };
+    }
+
+    template<unsigned N>
+    fq12 pow(const intx::uint<N>& e) const
+    {
+        fq12 r = one();
+        for (int i = N - 1 - clz(e); i >= 0; --i) {
+            r = r.square();
+            if ((e[i / 64] >> (i % 64)) & 1)
+                r = r * *this;
+        }
+        return r;
+    }
+
+    bool operator==(const fq12& b) const { return c0 == b.c0 && c1 == b.c1; }
+};
+
+// Constants derived from xi on first use.
+struct tower_t
+{
+    // b / xi, the coefficient of the twist E': y^2 = x^3 + b / xi.
+    fq2 twist_b;
+
+    // xi^((p - 1) / 3) and xi^((p - 1) / 2) for the Frobenius of E', and
+    // the same for p^2, where they are in Fq.
+    fq2 frob_x1, frob_y1;
+    fq2 frob_x2, frob_y2;
+
+    // gamma[j] = xi^(j * (p^2 - 1) / 6), the p^2 Frobenius of w^j.
+    fq2 gamma2[6];
+
+    // (p^4 - p^2 + 1) / r, the hard part of the final exponentiation.
+    intx::uint<1024> hard_exponent;
+
+    tower_t()
+    {
+        const uint256 p = field::fq_params::modulus;
+        const fq2 xi = fq2::one().mul_by_xi();
+
+        twist_b = fq2{ Fq::from_uint256(3), Fq::zero() } * xi.inv();
+
+        frob_x1 = xi.pow((p - 1) / 3);
+        frob_y1 = xi.pow((p - 1) / 2);
+        frob_x2 = frob_x1 * frob_x1.conj();
+        frob_y2 = frob_y1 * frob_y1.conj();
+
+        // xi^((p^2 - 1) / 6) = xi^((p - 1) / 6) * conj(xi^((p - 1) / 6)).
+        const fq2 g = xi.pow((p - 1) / 6);
+        const fq2 g2 = g * g.conj();
+        gamma2[0] = fq2::one();
+        for (int j = 1; j < 6; ++j)
+            gamma2[j] = gamma2[j - 1] * g2;
+
+        const intx::uint<1024> p1024 = p;
+        const intx::uint<1024> r = field::fr_params::modulus;
+        const intx::uint<1024> p2 = p1024 * p1024;
+        hard_exponent = (p2 * p2 - p2 + 1) / r;
+    }
+};
+
+const tower_t&
+tower()
+{
+    static const tower_t t;
+    return t;
+}
+
+// The p^2 Frobenius of Fq12. The coefficient of w^j is scaled by
+// gamma2[j]; the conjugation of Fq2 cancels out for p^2.
+fq12
+frobenius2(const fq12& f)
+{
+    const fq2* g = tower().gamma2;
+    return { { f.c0.c0, f.c0.c1 * g[2], f.c0.c2 * g[4] },
+             { f.c1.c0 * g[1], f.c1.c1 * g[3], f.c1.c2 * g[5] } };
+}
+
+fq12
+final_exponentiation(const fq12& f)
+{
+    // Easy part: f^((p^6 - 1) * (p^2 + 1)).
+    fq12 r = f.conj() * f.inv();
+    r = frobenius2(r) * r;
+    return r.pow(tower().hard_exponent);
+}
+
+typedef struct
+{
+    Fq x, y;
+    bool infinity;
+} g1_affine_t;
+
+typedef struct
+{
+    fq2 x, y;
+    bool infinity;
+} g2_affine_t;
+
+typedef struct
+{
+    Fq x, y, z;
+} g1_jacobian_t;
+
+bool
+load_fq(const char* src, Fq& out)
+{
+    const uint256 v = be::unsafe::load<uint256>((const uint8_t*)src);
+    if (v >= field::fq_params::modulus)
+        return false;
+    out = Fq::from_uint256(v);
+    return true;
+}
+
+void
+store_fq(char* dst, const Fq& v)
+{
+    v.store((uint8_t*)dst);
+}
+
+bool
+load_g1(const char* src, g1_affine_t& p)
+{
+    if (!load_fq(src, p.x) || !load_fq(src + 32, p.y))
+        return false;
+    p.infinity = p.x.is_zero() && p.y.is_zero();
+    if (p.infinity)
+        return true;
+    return p.y.square() == p.x.square() * p.x + Fq::from_uint256(3);
+}
+
+// Coordinates are encoded as the imaginary part first.
+bool
+load_g2(const char* src, g2_affine_t& p)
+{
+    if (!load_fq(src, p.x.c1) || !load_fq(src + 32, p.x.c0) ||
+        !load_fq(src + 64, p.y.c1) || !load_fq(src + 96, p.y.c0))
+        return false;
+    p.infinity = p.x.is_zero() && p.y.is_zero();
+    if (p.infinity)
+        return true;
+    return p.y.square() == p.x.square() * p.x + tower().twist_b;
+}
+
+void
+store_g1(char* dst, const g1_jacobian_t& p)
+{
+    if (p.z.is_zero()) {
+        store_fq(dst, Fq::zero());
+        store_fq(dst + 32, Fq::zero());
+        return;
+    }
+    const Fq zi = p.z.inv();
+    const Fq zi2 = zi.square();
+    store_fq(dst, p.x * zi2);
+    store_fq(dst + 32, p.y * zi2 * zi);
+}
+
+g1_jacobian_t
+to_jacobian(const g1_affine_t& p)
+{
+    if (p.infinity)
+        return { Fq::one(), Fq::one(), Fq::zero() };
+    return { p.x, p.y, Fq::one() };
+}
+
+g1_jacobian_t
+g1_double(const g1_jacobian_t& p)
+{
+    if (p.z.is_zero())
+        return p;
+    const Fq a = p.x.square();
+    const Fq b = p.y.square();
+    const Fq c = b.square();
+    Fq d = (p.x + b).square() - a - c;
+    d += d;
+    const Fq e = a + a + a;
+    const Fq f = e.square();
+    const Fq x3 = f - d - d;
+    Fq c8 = c + c;
+    c8 += c8;
+    c8 += c8;
+    const Fq y3 = e * (d - x3) - c8;
+    const Fq z3 = (p.y + p.y) * p.z;
+    return { x3, y3, z3 };
+}
+
+g1_jacobian_t
+g1_add(const g1_jacobian_t& p, const g1_jacobian_t& q)
+{
+    if (p.z.is_zero())
+        return q;
+    if (q.z.is_zero())
+        return p;
+
+    const Fq z1z1 = p.z.square();
+    const Fq z2z2 = q.z.square();
+    const Fq u1 = p.x * z2z2;
+    const Fq u2 = q.x * z1z1;
+    const Fq s1 = p.y * q.z * z2z2;
+    const Fq s2 = q.y * p.z * z1z1;
+
+    if (u1 == u2) {
+        if (s1 == s2)
+            return g1_double(p);
+        return { Fq::one(), Fq::one(), Fq::zero() };
+    }
+
+    const Fq h = u2 - u1;
+    const Fq i = (h + h).square();
+    const Fq j = h * i;
+    const Fq r = (s2 - s1) + (s2 - s1);
+    const Fq v = u1 * i;
+    const Fq x3 = r.square() - j - v - v;
+    const Fq s1j = s1 * j;
+    const Fq y3 = r * (v - x3) - s1j - s1j;
+    const Fq z3 = ((p.z + q.z).square() - z1z1 - z2z2) * h;
+    return { x3, y3, z3 };
+}
+
+// Affine G2 arithmetic, which is all the Miller loop and the host helper
+// need. Neither ever adds a point to its negation.
+g2_affine_t
+g2_double(const g2_affine_t& t, fq2* slope = nullptr)
+{
+    if (t.infinity)
+        return t;
+    const fq2 x2 = t.x.square();
+    const fq2 lambda = (x2 + x2 + x2) * (t.y + t.y).inv();
+    const fq2 x3 = lambda.square() - t.x - t.x;
+    if (slope)
+        *slope = lambda;
+    return { x3, lambda * (t.x - x3) - t.y, false };
+}
+
+g2_affine_t
+g2_add(const g2_affine_t& t, const g2_affine_t& q, fq2* slope = nullptr)
+{
+    if (t.infinity)
+        return q;
+    if (q.infinity)
+        return t;
+    if (t.x == q.x) {
+        if (t.y == q.y)
+            return g2_double(t, slope);
+        return { fq2(), fq2(), true };
+    }
+    const fq2 lambda = (q.y - t.y) * (q.x - t.x).inv();
+    const fq2 x3 = lambda.square() - t.x - q.x;
+    if (slope)
+        *slope = lambda;
+    return { x3, lambda * (t.x - x3) - t.y, false };
+}
+
+// The line through T with the given slope on the twist, mapped into E(Fq12)
+// by (x, y) -> (x w^2, y w^3) and evaluated at P:
+//   y_P - slope x_P w + (slope x_T - y_T) w^3
+fq12
+line(const g2_affine_t& t, const fq2& slope, const g1_affine_t& p)
+{
+    return { { fq2{ p.y, Fq::zero() }, fq2(), fq2() },
+             { -(slope * p.x), slope * t.x - t.y, fq2() } };
+}
+
+// 6x + 2 for the BN parameter x = 4965661367192848881, as low and high
+// words.
+const uint128 ate_loop_count{ 0x9d797039be763ba8, 1 };
+
+fq12
+miller_loop(const g1_affine_t& p, const g2_affine_t& q)
+{
+    fq12 f = fq12::one();
+    g2_affine_t t = q;
+    fq2 slope;
+
+    int top = 127;
+    while (!((ate_loop_count >> top) & 1))
+        --top;
+
+    for (int i = top - 1; i >= 0; --i) {
+        const g2_affine_t d = g2_double(t, &slope);
+        f = f.square() * line(t, slope, p);
+        t = d;
+        if ((ate_loop_count >> i) & 1) {
+            const g2_affine_t s = g2_add(t, q, &slope);
+            f = f * line(t, slope, p);
+            t = s;
+        }
+    }
+
+    // The two extra lines with pi(Q) and -pi^2(Q).
+    const tower_t& c = tower();
+    const g2_affine_t q1 = { q.x.conj() * c.frob_x1,
+                             q.y.conj() * c.frob_y1,
+                             false };
+    const g2_affine_t q2 = { q.x * c.frob_x2, -(q.y * c.frob_y2), false };
+
+    const g2_affine_t s = g2_add(t, q1, &slope);
+    f = f * line(t, slope, p);
+    t = s;
+    g2_add(t, q2, &slope);
+    f = f * line(t, slope, p);
+
+    return f;
+}
+
+} // namespace
+
+host::call_counts_t host::call_counts;
+
+namespace eosio {
+
+int32_t
+alt_bn128_add(const char* op1,
+              uint32_t op1_len,
+              const char* op2,
+              uint32_t op2_len,
+              char* result,
+              uint32_t result_len)
+{
+    host::call_counts.alt_bn128_add++;
+
+    g1_affine_t a, b;
+    if (op1_len != 64 || op2_len != 64 || result_len < 64 ||
+        !load_g1(op1, a) || !load_g1(op2, b))
+        return -1;
+
+    store_g1(result, g1_add(to_jacobian(a), to_jacobian(b)));
+    return 0;
+}
+
+int32_t
+alt_bn128_mul(const char* g1,
+              uint32_t g1_len,
+              const char* scalar,
+              uint32_t scalar_len,
+              char* result,
+              uint32_t result_len)
+{
+    host::call_counts.alt_bn128_mul++;
+
+    g1_affine_t a;
+    if (g1_len != 64 || scalar_len != 32 || result_len < 64 ||
+        !load_g1(g1, a))
+        return -1;
+
+    const uint256 s = be::unsafe::load<uint256>((const uint8_t*)scalar);
+    const g1_jacobian_t base = to_jacobian(a);
+    g1_jacobian_t r = { Fq::one(), Fq::one(), Fq::zero() };
+    for (int i = 255; i >= 0; --i) {
+        r = g1_double(r);
+        if ((s[i / 64] >> (i % 64)) & 1)
+            r = g1_add(r, base);
+    }
+
+    store_g1(result, r);
+    return 0;
+}
+
+int32_t
+alt_bn128_pair(const char* pairs, uint32_t pairs_len)
+{
+    host::call_counts.alt_bn128_pair++;
+
+    if (pairs_len % 192 != 0)
+        return -1;
+
+    fq12 f = fq12::one();
+    for (uint32_t i = 0; i < pairs_len; i += 192) {
+        g1_affine_t p;
+        g2_affine_t q;
+        if (!load_g1(pairs + i, p) || !load_g2(pairs + i + 64, q))
+            return -1;
+        if (p.infinity || q.infinity)
+            continue;
+        f = f * miller_loop(p, q);
+    }
+
+    return final_exponentiation(f) == fq12::one() ? 0 : 1;
+}
+
+} // namespace eosio
+
+namespace host {
+
+eosio::g1_point
+make_g1_point(const uint256& x, const uint256& y)
+{
+    char out[64];
+    be::unsafe::store((uint8_t*)out, x);
+    be::unsafe::store((uint8_t*)(out + 32), y);
+    return eosio::g1_point(out);
+}
+
+eosio::g2_point
+make_g2_point(const uint256& x1,
+              const uint256& x2,
+              const uint256& y1,
+              const uint256& y2)
+{
+    char out[128];
+    be::unsafe::store((uint8_t*)out, x2);
+    be::unsafe::store((uint8_t*)(out + 32), x1);
+    be::unsafe::store((uint8_t*)(out + 64), y2);
+    be::unsafe::store((uint8_t*)(out + 96), y1);
+    return eosio::g2_point(out);
+}
+
+eosio::g2_point
+g2_mul(const eosio::g2_point& q, const intx::uint256& s)
+{
+    const auto raw = q.serialized();
+    g2_affine_t base;
+    eosio::check(load_g2(raw.data(), base), "g2_mul: invalid point");
+
+    g2_affine_t r = { fq2(), fq2(), true };
+    for (int i = 255; i >= 0; --i) {
+        r = g2_double(r);
+        if ((s[i / 64] >> (i % 64)) & 1)
+            r = g2_add(r, base);
+    }
+
+    char out[128] = {};
+    if (!r.infinity) {
+        store_fq(out, r.x.c1);
+        store_fq(out + 32, r.x.c0);
+        store_fq(out + 64, r.y.c1);
+        store_fq(out + 96, r.y.c0);
+    }
+    return eosio::g2_point(out);
+}
+
+} // namespace host
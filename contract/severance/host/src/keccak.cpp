@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Software Keccak-256 (the original padding used by Ethereum and by the
+// nodeos keccak host function) for the native build.
+
+#include <algorithm>
+#include <cstring>
+#include <eosio/crypto_ext.hpp>
+#include <host.hpp>
+
+namespace {
+
+const uint64_t round_constants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+    0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+    0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+    0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+    0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+    0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+};
+
+const int rotations[25] = { 0,  1,  62, 28, 27, 36, 44, 6,  55,
+                            20, 3,  10, 43, 25, 39, 41, 45, 15,
+                            21, 8,  18, 2,  61, 56, 14 };
+
+const int rate = 136;
+
+inline uint64_t
+rotl(uint64_t x, int n)
+{
+    return n == 0 ? x : (x << n) | (x >> (64 - n));
+}
+
+void
+keccak_f(uint64_t a[25])
+{
+    for (int round = 0; round < 24; ++round) {
+        uint64_t c[5];
+        for (int x = 0; x < 5; ++x)
+            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        for (int x = 0; x < 5; ++x) {
+            const uint64_t d = c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+            for (int y = 0; y < 25; y += 5)
+                a[y + x] ^= d;
+        }
+
+        // rho and pi: lane (x, y) moves to (y, 2x + 3y).
+        uint64_t b[25];
+        for (int x = 0; x < 5; ++x) {
+            for (int y = 0; y < 5; ++y) {
+                b[y + 5 * ((2 * x + 3 * y) % 5)] =
+                  rotl(a[x + 5 * y], rotations[x + 5 * y]);
+            }
+        }
+
+        for (int y = 0; y < 25; y += 5) {
+            for (int x = 0; x < 5; ++x) {
+                a[y + x] =
+                  b[y + x] ^ (~b[y + (x + 1) % 5] & b[y + (x + 2) % 5]);
+            }
+        }
+
+        a[0] ^= round_constants[round];
+    }
+}
+
+void
+absorb(uint64_t state[25], const uint8_t* block)
+{
+    for (int i = 0; i < rate / 8; ++i) {
+        uint64_t lane = 0;
+        for (int j = 7; j >= 0; --j)
+            lane = lane << 8 | block[8 * i + j];
+        state[i] ^= lane;
+    }
+    keccak_f(state);
+}
+
+} // namespace
+
+namespace host {
+
+void
+keccak_sponge::absorb(const void* data, std::size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+
+    if (length > 0) {
+        const std::size_t n = std::min(size, (std::size_t)rate - length);
+        memcpy(block + length, p, n);
+        length += n;
+        p += n;
+        size -= n;
+        if (length < rate)
+            return;
+        ::absorb(state, block);
+        length = 0;
+    }
+
+    for (; size >= rate; size -= rate, p += rate)
+        ::absorb(state, p);
+
+    memcpy(block, p, size);
+    length = size;
+}
+
+eosio::checksum256
+keccak_sponge::finish()
+{
+    call_counts.keccak++;
+
+    memset(block + length, 0, rate - length);
+    block[length] ^= 0x01;
+    block[rate - 1] ^= 0x80;
+    ::absorb(state, block);
+
+    std::array<uint8_t, 32> digest;
+    for (int i = 0; i < 32; ++i)
+        digest[i] = state[i / 8] >> (8 * (i % 8));
+
+    memset(state, 0, sizeof(state));
+    length = 0;
+    return eosio::checksum256(digest);
+}
+
+} // namespace host
+
+namespace eosio {
+
+checksum256
+keccak(const char* data, uint32_t length)
+{
+    host::keccak_sponge sponge;
+    sponge.absorb(data, length);
+    return sponge.finish();
+}
+
+} // namespace eosio
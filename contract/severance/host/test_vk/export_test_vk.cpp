@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Writes the keys of test_vk.hpp as the verification_key.json snarkjs
+// would, for vk_gen to turn into the headers of the native build:
+//
+//   export_test_vk plonk|fflonk|groth16 [verification_key.json]
+
+#include <constants.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <host.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <test_vk.hpp>
+
+using intx::uint256;
+
+static std::string
+number(const uint256& x)
+{
+    return "\"" + intx::to_string(x) + "\"";
+}
+
+static uint256
+load(const std::vector<char>& v, size_t offset)
+{
+    return intx::be::unsafe::load<uint256>((const uint8_t*)v.data() + offset);
+}
+
+static std::string
+g1(const uint256& s)
+{
+    const eosio::g1_point p = test_vk::g1(s);
+    return "[" + number(load(p.x, 0)) + ", " + number(load(p.y, 0)) +
+           ", \"1\"]";
+}
+
+// s * G2. The host functions put the imaginary parts first, snarkjs last.
+static std::string
+g2(const uint256& s)
+{
+    std::vector<char> x(64), y(64);
+    intx::be::unsafe::store((uint8_t*)x.data(), G2x2);
+    intx::be::unsafe::store((uint8_t*)x.data() + 32, G2x1);
+    intx::be::unsafe::store((uint8_t*)y.data(), G2y2);
+    intx::be::unsafe::store((uint8_t*)y.data() + 32, G2y1);
+    const eosio::g2_point p = host::g2_mul(eosio::g2_point{ x, y }, s);
+
+    return "[[" + number(load(p.x, 32)) + ", " + number(load(p.x, 0)) +
+           "], [" + number(load(p.y, 32)) + ", " + number(load(p.y, 0)) +
+           "], [\"1\", \"0\"]]";
+}
+
+static void
+domain(std::ostream& out)
+{
+    out << "  \"nPublic\": " << PUBLIC << ",\n"
+        << "  \"power\": " << test_vk::power << ",\n"
+        << "  \"k1\": " << number(test_vk::k1) << ",\n"
+        << "  \"k2\": " << number(test_vk::k2) << ",\n"
+        << "  \"w\": " << number(test_vk::w1) << ",\n";
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc != 2 && argc != 3) {
+        fprintf(stderr, "usage: %s plonk|fflonk|groth16 [json]\n", argv[0]);
+        return 2;
+    }
+
+    std::ostringstream out;
+    const std::string protocol = argv[1];
+    out << "{\n  \"protocol\": \"" << protocol << "\",\n"
+        << "  \"curve\": \"bn128\",\n";
+    if (protocol == "plonk") {
+        domain(out);
+        out << "  \"Qm\": " << g1(test_vk::qm) << ",\n"
+            << "  \"Ql\": " << g1(test_vk::ql) << ",\n"
+            << "  \"Qr\": " << g1(test_vk::qr) << ",\n"
+            << "  \"Qo\": " << g1(test_vk::qo) << ",\n"
+            << "  \"Qc\": " << g1(test_vk::qc) << ",\n"
+            << "  \"S1\": " << g1(test_vk::s1) << ",\n"
+            << "  \"S2\": " << g1(test_vk::s2) << ",\n"
+            << "  \"S3\": " << g1(test_vk::s3) << ",\n"
+            << "  \"X_2\": " << g2(test_vk::tau) << "\n";
+    } else if (protocol == "fflonk") {
+        domain(out);
+        out << "  \"w3\": " << number(test_vk::w3) << ",\n"
+            << "  \"w4\": " << number(test_vk::w4) << ",\n"
+            << "  \"w8\": " << number(test_vk::w8) << ",\n"
+            << "  \"wr\": " << number(test_vk::wr) << ",\n"
+            << "  \"C0\": " << g1(test_vk::c0) << ",\n"
+            << "  \"X_2\": " << g2(test_vk::tau) << "\n";
+    } else if (protocol == "groth16") {
+        namespace g16 = test_vk::groth16;
+        out << "  \"nPublic\": " << PUBLIC << ",\n"
+            << "  \"vk_alpha_1\": " << g1(g16::alpha) << ",\n"
+            << "  \"vk_beta_2\": " << g2(g16::beta) << ",\n"
+            << "  \"vk_gamma_2\": " << g2(g16::gamma) << ",\n"
+            << "  \"vk_delta_2\": " << g2(g16::delta) << ",\n"
+            << "  \"IC\": [";
+        for (size_t i = 0; i < sizeof(g16::ic) / sizeof(g16::ic[0]); ++i)
+            out << (i ? ",\n    " : "\n    ") << g1(g16::ic[i]);
+        out << "\n  ]\n";
+    } else {
+        fprintf(stderr, "unknown protocol %s\n", argv[1]);
+        return 2;
+    }
+    out << "}\n";
+
+    if (argc == 3) {
+        std::ofstream file(argv[2]);
+        file << out.str();
+        if (!file) {
+            fprintf(stderr, "cannot write %s\n", argv[2]);
+            return 1;
+        }
+    } else {
+        std::cout << out.str();
+    }
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Produces valid FFLONK proofs for the test verification key from its
+// trapdoor, like test_prover.hpp does for PLONK.
+//
+// C1, C2 and W1 are known multiples of G1 and the evaluations are random.
+// The opening values are interpolated with the plain Lagrange formula over
+// the listed points, independently of the verifier's closed forms, and W2
+// is solved for so that
+//   tau W2 = F - E - J + y W2
+
+#pragma once
+
+#include <cstring>
+#include <eosio/crypto_ext.hpp>
+#include <fflonk_verifier.hpp>
+#include <field.hpp>
+#include <intx.h>
+#include <test_vk.hpp>
+#include <vector>
+
+namespace test_vk {
+
+class fflonk_prover
+{
+  public:
+    explicit fflonk_prover(uint64_t seed)
+      : state(seed * 0xbf58476d1ce4e5b9 + 1)
+    {
+    }
+
+    fflonk_proof prove(const withdraw_inputs& inputs)
+    {
+        const Fr c1 = random_fr(), c2 = random_fr(), w1s = random_fr();
+
+        // ql qr qm qo qc s1 s2 s3 a b c z zw t1w t2w
+        Fr ev[15];
+        for (auto& e : ev)
+            e = random_fr();
+        const Fr &ql = ev[0], &qr = ev[1], &qm = ev[2], &qo = ev[3];
+        const Fr &qc = ev[4], &s1 = ev[5], &s2 = ev[6], &s3 = ev[7];
+        const Fr &a = ev[8], &b = ev[9], &c = ev[10], &z = ev[11];
+        const Fr &zw = ev[12], &t1w = ev[13], &t2w = ev[14];
+
+        fflonk_proof proof;
+        proof.C1 = point(c1);
+        proof.C2 = point(c2);
+        proof.W1 = point(w1s);
+        for (int i = 0; i < 15; ++i)
+            ev[i].store((uint8_t*)&proof.eval_ql + 32 * i);
+        random_fr().store((uint8_t*)proof.eval_inv.data());
+
+        std::vector<char> buffer;
+        append(buffer, point(vk(c0)));
+        buffer.insert(buffer.end(),
+                      (const char*)&inputs,
+                      (const char*)&inputs + sizeof(inputs));
+        append(buffer, proof.C1);
+        const Fr beta = hash(buffer);
+
+        buffer.clear();
+        append(buffer, beta);
+        const Fr gamma = hash(buffer);
+
+        buffer.clear();
+        append(buffer, gamma);
+        append(buffer, proof.C2);
+        const Fr xi_seed = hash(buffer);
+
+        buffer.clear();
+        append(buffer, xi_seed);
+        for (const Fr& e : ev)
+            append(buffer, e);
+        const Fr alpha = hash(buffer);
+
+        buffer.clear();
+        append(buffer, alpha);
+        append(buffer, proof.W1);
+        const Fr y = hash(buffer);
+
+        const Fr w = vk(w1);
+        const Fr h0 = xi_seed.pow(3);
+        const Fr h1 = xi_seed.pow(6);
+        const Fr h2 = xi_seed.pow(8);
+        const Fr h3 = h2 * vk(wr);
+        const Fr xi = xi_seed.pow(24);
+
+        Fr xin = xi;
+        Fr n = Fr::one();
+        for (int i = 0; i < power; ++i) {
+            xin = xin.square();
+            n += n;
+        }
+        const Fr zh = xin - Fr::one();
+
+        Fr pi, l0, wi = Fr::one();
+        for (int i = 0; i < PUBLIC; ++i) {
+            const Fr li = wi * zh * (n * (xi - wi)).inv();
+            if (i == 0)
+                l0 = li;
+            pi -= Fr::load((const uint8_t*)inputs[i].data()) * li;
+            wi *= w;
+        }
+
+        const Fr t0 =
+          (ql * a + qr * b + qm * a * b + qo * c + qc + pi) * zh.inv();
+        const Fr t1 = (z - Fr::one()) * l0 * zh.inv();
+        const Fr bx = beta * xi;
+        const Fr t2 = ((a + bx + gamma) * (b + bx * vk(k1) + gamma) *
+                         (c + bx * vk(k2) + gamma) * z -
+                       (a + beta * s1 + gamma) * (b + beta * s2 + gamma) *
+                         (c + beta * s3 + gamma) * zw) *
+                      zh.inv();
+
+        // The opening points and the values of C0, C1, C2 there.
+        std::vector<Fr> x0, v0, x1, v1, x2, v2;
+        Fr root = h0;
+        for (int i = 0; i < 8; ++i, root *= vk(w8)) {
+            x0.push_back(root);
+            v0.push_back(poly({ ql, qr, qo, qm, qc, s1, s2, s3 }, root));
+        }
+        root = h1;
+        for (int i = 0; i < 4; ++i, root *= vk(w4)) {
+            x1.push_back(root);
+            v1.push_back(poly({ a, b, c, t0 }, root));
+        }
+        root = h2;
+        for (int i = 0; i < 3; ++i, root *= vk(w3)) {
+            x2.push_back(root);
+            v2.push_back(poly({ z, t1, t2 }, root));
+        }
+        root = h3;
+        for (int i = 0; i < 3; ++i, root *= vk(w3)) {
+            x2.push_back(root);
+            v2.push_back(poly({ zw, t1w, t2w }, root));
+        }
+
+        const Fr zs0 = vanishing(x0, y);
+        const Fr q1 = alpha * zs0 * vanishing(x1, y).inv();
+        const Fr q2 = alpha.square() * zs0 * vanishing(x2, y).inv();
+        const Fr e = interpolate(x0, v0, y) + q1 * interpolate(x1, v1, y) +
+                     q2 * interpolate(x2, v2, y);
+
+        const Fr f = vk(c0) + q1 * c1 + q2 * c2;
+        const Fr w2s = (f - e - zs0 * w1s) * (vk(tau) - y).inv();
+        proof.W2 = point(w2s);
+
+        return proof;
+    }
+
+  private:
+    static Fr vk(const intx::uint256& x) { return Fr::from_uint256(x); }
+
+    static std::array<char, 64> point(const Fr& s)
+    {
+        const eosio::g1_point p = g1(s.to_uint256());
+        std::array<char, 64> r;
+        memcpy(r.data(), p.x.data(), 32);
+        memcpy(r.data() + 32, p.y.data(), 32);
+        return r;
+    }
+
+    static Fr poly(std::initializer_list<Fr> coefficients, const Fr& x)
+    {
+        Fr r, xi = Fr::one();
+        for (const Fr& c : coefficients) {
+            r += c * xi;
+            xi *= x;
+        }
+        return r;
+    }
+
+    static Fr vanishing(const std::vector<Fr>& xs, const Fr& y)
+    {
+        Fr r = Fr::one();
+        for (const Fr& x : xs)
+            r *= y - x;
+        return r;
+    }
+
+    static Fr interpolate(const std::vector<Fr>& xs,
+                          const std::vector<Fr>& vs,
+                          const Fr& y)
+    {
+        Fr r;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            Fr num = Fr::one(), den = Fr::one();
+            for (size_t j = 0; j < xs.size(); ++j) {
+                if (j == i)
+                    continue;
+                num *= y - xs[j];
+                den *= xs[i] - xs[j];
+            }
+            r += vs[i] * num * den.inv();
+        }
+        return r;
+    }
+
+    static Fr hash(const std::vector<char>& data)
+    {
+        const auto digest = eosio::keccak(data.data(), data.size());
+        return Fr::load(digest.extract_as_byte_array().data());
+    }
+
+    static void append(std::vector<char>& out, const std::array<char, 64>& p)
+    {
+        out.insert(out.end(), p.begin(), p.end());
+    }
+
+    static void append(std::vector<char>& out, const Fr& x)
+    {
+        uint8_t b[32];
+        x.store(b);
+        out.insert(out.end(), b, b + 32);
+    }
+
+    // xorshift64*
+    uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545f4914f6cdd1d;
+    }
+
+    Fr random_fr()
+    {
+        const intx::uint256 x{ next(), next(), next(), next() };
+        return Fr::from_uint256(x);
+    }
+
+    uint64_t state;
+};
+
+} // namespace test_vk
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Produces valid Groth16 proofs for the test verification key from its
+// trapdoor. A and B are random multiples of the generators and C is solved
+// for so that
+//   a b = alpha beta + l gamma + c delta,  l = ic[0] + sum input_i ic[i + 1]
+
+#pragma once
+
+#include <constants.hpp>
+#include <cstring>
+#include <field.hpp>
+#include <groth16_verifier.hpp>
+#include <host.hpp>
+#include <test_vk.hpp>
+
+namespace test_vk {
+
+class groth16_prover
+{
+  public:
+    explicit groth16_prover(uint64_t seed)
+      : state(seed * 0x94d049bb133111eb + 1)
+    {
+    }
+
+    groth16_proof prove(const withdraw_inputs& inputs)
+    {
+        const Fr a = random_fr(), b = random_fr();
+
+        Fr l = vk(groth16::ic[0]);
+        for (int i = 0; i < PUBLIC; ++i)
+            l += Fr::load((const uint8_t*)inputs[i].data()) *
+                 vk(groth16::ic[i + 1]);
+
+        const Fr c = (a * b - vk(groth16::alpha) * vk(groth16::beta) -
+                      l * vk(groth16::gamma)) *
+                     vk(groth16::delta).inv();
+
+        const eosio::g1_point A = g1(a.to_uint256());
+        const eosio::g2_point B = host::g2_mul(
+          host::make_g2_point(G2x1, G2x2, G2y1, G2y2), b.to_uint256());
+        const eosio::g1_point C = g1(c.to_uint256());
+
+        groth16_proof proof;
+        memcpy(proof.A.data(), A.serialized().data(), 64);
+        memcpy(proof.B.data(), B.serialized().data(), 128);
+        memcpy(proof.C.data(), C.serialized().data(), 64);
+        return proof;
+    }
+
+  private:
+    static Fr vk(const intx::uint256& x) { return Fr::from_uint256(x); }
+
+    // xorshift64*
+    uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545f4914f6cdd1d;
+    }
+
+    Fr random_fr()
+    {
+        const intx::uint256 x{ next(), next(), next(), next() };
+        return Fr::from_uint256(x);
+    }
+
+    uint64_t state;
+};
+
+} // namespace test_vk
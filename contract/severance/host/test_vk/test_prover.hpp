@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Produces valid PLONK proofs for the test verification key from its
+// trapdoor, for the native tests and benchmarks.
+//
+// Every commitment is chosen as a known multiple of G1 and every evaluation
+// at random. The transcript is replayed with the same Keccak challenges as
+// the verifier. The two opening proofs are then solved for so that
+//   tau * (Wxi + u Wxiw) = xi Wxi + u xi w Wxiw + F - E
+// holds for any u: the u-free and the u-linear parts are balanced
+// separately, so u can be derived from Wxi and Wxiw afterwards.
+
+#pragma once
+
+#include <eosio/crypto_ext.hpp>
+#include <field.hpp>
+#include <intx.h>
+#include <cstring>
+#include <test_vk.hpp>
+#include <vector>
+#include <verifier.hpp>
+
+namespace test_vk {
+
+// Layout of the withdraw proof_data: nine G1 points then seven scalars.
+const int proof_size = 9 * 64 + 7 * 32;
+
+// The proof and inputs as the withdraw action receives them.
+inline withdraw_proof
+to_withdraw_proof(const std::vector<char>& data)
+{
+    withdraw_proof proof;
+    memcpy(&proof, data.data(), sizeof(proof));
+    return proof;
+}
+
+inline withdraw_inputs
+to_withdraw_inputs(const std::vector<std::vector<char>>& inputs)
+{
+    withdraw_inputs r;
+    for (int i = 0; i < PUBLIC; ++i)
+        memcpy((char*)&r + 32 * i, inputs[i].data(), 32);
+    return r;
+}
+
+class prover
+{
+  public:
+    explicit prover(uint64_t seed)
+      : state(seed * 0x9e3779b97f4a7c15 + 1)
+    {
+    }
+
+    // A public input below q, big endian.
+    std::vector<char> random_input()
+    {
+        std::vector<char> r(32);
+        random_fr().store((uint8_t*)r.data());
+        return r;
+    }
+
+    std::vector<char> prove(const std::vector<std::vector<char>>& inputs)
+    {
+        const Fr a = random_fr(), b = random_fr(), c = random_fr();
+        const Fr z = random_fr();
+        const Fr t1 = random_fr(), t2 = random_fr(), t3 = random_fr();
+
+        Fr evals[7];
+        for (auto& e : evals)
+            e = random_fr();
+        const Fr &ea = evals[0], &eb = evals[1], &ec = evals[2];
+        const Fr &es1 = evals[3], &es2 = evals[4], &ezw = evals[5];
+        const Fr& er = evals[6];
+
+        std::vector<char> out;
+        out.reserve(proof_size);
+        for (const Fr& s : { a, b, c, z, t1, t2, t3 })
+            append(out, g1(s.to_uint256()));
+
+        std::vector<char> buffer;
+        for (const auto& input : inputs)
+            buffer.insert(buffer.end(), input.begin(), input.end());
+        buffer.insert(buffer.end(), out.begin(), out.begin() + 3 * 64);
+        const Fr beta = hash(buffer);
+
+        buffer.assign(32, 0);
+        beta.store((uint8_t*)buffer.data());
+        const Fr gamma = hash(buffer);
+
+        buffer.assign(out.begin() + 3 * 64, out.begin() + 4 * 64);
+        const Fr alpha = hash(buffer);
+
+        buffer.assign(out.begin() + 4 * 64, out.begin() + 7 * 64);
+        const Fr xi = hash(buffer);
+
+        buffer.clear();
+        for (const Fr& e : evals)
+            append(buffer, e);
+        Fr v[6];
+        v[0] = hash(buffer);
+        for (int i = 1; i < 6; ++i)
+            v[i] = v[i - 1] * v[0];
+
+        // Lagrange evaluations and the quotient evaluation t.
+        Fr xin = xi;
+        Fr n = Fr::one();
+        for (int i = 0; i < power; ++i) {
+            xin = xin.square();
+            n += n;
+        }
+        const Fr zh = xin - Fr::one();
+        const Fr w = Fr::from_uint256(w1);
+
+        Fr pl, l0, wi = Fr::one();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const Fr li = wi * zh * (n * (xi - wi)).inv();
+            if (i == 0)
+                l0 = li;
+            pl -= Fr::load((const uint8_t*)inputs[i].data()) * li;
+            wi *= w;
+        }
+
+        const Fr e1 = ea + beta * es1 + gamma;
+        const Fr e2 = eb + beta * es2 + gamma;
+        const Fr e3 = ec + gamma;
+        const Fr t = (er + pl - e1 * e2 * e3 * ezw * alpha -
+                      l0 * alpha.square()) *
+                     zh.inv();
+
+        // Discrete logs of D, F and E without their u terms.
+        const Fr beta_xi = beta * xi;
+        const Fr s6 = (ea + beta_xi + gamma) *
+                        (eb + beta_xi * Fr::from_uint256(k1) + gamma) *
+                        (ec + beta_xi * Fr::from_uint256(k2) + gamma) *
+                        alpha * v[0] +
+                      l0 * alpha.square() * v[0];
+        const Fr s7 = e1 * e2 * alpha * v[0] * beta * ezw;
+
+        const Fr d = ea * eb * v[0] * vk(qm) + ea * v[0] * vk(ql) +
+                     eb * v[0] * vk(qr) + ec * v[0] * vk(qo) +
+                     v[0] * vk(qc) + s6 * z - s7 * vk(s3);
+        const Fr f = t1 + xin * t2 + xin.square() * t3 + d + v[1] * a +
+                     v[2] * b + v[3] * c + v[4] * vk(s1) + v[5] * vk(s2);
+        const Fr e = t + v[0] * er + v[1] * ea + v[2] * eb + v[3] * ec +
+                     v[4] * es1 + v[5] * es2;
+
+        const Fr tau_fr = vk(tau);
+        const Fr wxi = (f - e) * (tau_fr - xi).inv();
+        const Fr wxiw = (z - ezw) * (tau_fr - xi * w).inv();
+
+        append(out, g1(wxi.to_uint256()));
+        append(out, g1(wxiw.to_uint256()));
+        for (const Fr& e : evals)
+            append(out, e);
+
+        return out;
+    }
+
+  private:
+    static Fr vk(const intx::uint256& x) { return Fr::from_uint256(x); }
+
+    static Fr hash(const std::vector<char>& data)
+    {
+        const auto digest = eosio::keccak(data.data(), data.size());
+        return Fr::load(digest.extract_as_byte_array().data());
+    }
+
+    static void append(std::vector<char>& out, const eosio::g1_point& p)
+    {
+        out.insert(out.end(), p.x.begin(), p.x.end());
+        out.insert(out.end(), p.y.begin(), p.y.end());
+    }
+
+    static void append(std::vector<char>& out, const Fr& x)
+    {
+        uint8_t b[32];
+        x.store(b);
+        out.insert(out.end(), b, b + 32);
+    }
+
+    // xorshift64*
+    uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545f4914f6cdd1d;
+    }
+
+    Fr random_fr()
+    {
+        const intx::uint256 x{ next(), next(), next(), next() };
+        return Fr::from_uint256(x);
+    }
+
+    uint64_t state;
+};
+
+} // namespace test_vk
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Trapdoor of the test verification key of the native build. Every point
+// of the key is a known multiple of the G1 or G2 generator, so tests can
+// produce valid proofs without a circuit or a prover. Never deploy it.
+
+#pragma once
+
+#include <eosio/crypto_ext.hpp>
+#include <intx.h>
+
+namespace test_vk {
+
+using namespace intx::literals;
+
+constexpr int power = 13;
+
+// A primitive 2^13-th root of unity of Fr.
+constexpr intx::uint256 w1 =
+  197302210312744933010843010704445784068657690384188106020011018676818793232_u256;
+constexpr intx::uint256 k1 = 2;
+constexpr intx::uint256 k2 = 3;
+
+// X2 = tau * G2
+constexpr intx::uint256 tau =
+  18554442278642715153353856826593185970813502542674212342148585602458592190109_u256;
+
+// Qm = qm * G1 and so on.
+constexpr intx::uint256 qm =
+  21557365612200270544451905100729373511650911721868102776511985855049614555277_u256;
+constexpr intx::uint256 ql =
+  12643487277131688138405774571268970870197063299575899027034036787395049494616_u256;
+constexpr intx::uint256 qr =
+  6774643323703339178698749752268554356365755251967163925140303798371577420801_u256;
+constexpr intx::uint256 qo =
+  19416258740326582593686936867061247609772403632039280198703172006015032752448_u256;
+constexpr intx::uint256 qc =
+  10015414431697519660362065697110918929837373689621411980259092264308197581313_u256;
+constexpr intx::uint256 s1 =
+  12979640902452882651088811994372258585945376540705465098021443339063523551843_u256;
+constexpr intx::uint256 s2 =
+  21101633149501933811980896196150053784115073651169020474104143255884791924547_u256;
+constexpr intx::uint256 s3 =
+  10312688779829659056385413401762110239524575564838105744680036975757144271056_u256;
+
+// FFLONK: roots of unity of order 3, 4 and 8, a cube root of w1, and
+// C0 = c0 * G1.
+constexpr intx::uint256 w3 =
+  4407920970296243842393367215006156084916469457145843978461_u256;
+constexpr intx::uint256 w4 =
+  21888242871839275217838484774961031246007050428528088939761107053157389710902_u256;
+constexpr intx::uint256 w8 =
+  19540430494807482326159819597004422086093766032135589407132600596362845576832_u256;
+constexpr intx::uint256 wr =
+  2129038428448244545498370061182185360351374401964453567970968899241268283721_u256;
+constexpr intx::uint256 c0 =
+  4262548595527617082116271336986563961244342208806278608693330825378644672019_u256;
+
+// Groth16: alpha1 = alpha * G1, beta2 = beta * G2 and so on, and
+// IC[i] = ic[i] * G1.
+namespace groth16 {
+
+constexpr intx::uint256 alpha =
+  169449774194794391767090400654412445526948749934017877336517435689423126956_u256;
+constexpr intx::uint256 beta =
+  6438911048142564859502126348797685506469698709507043928434951081873835951573_u256;
+constexpr intx::uint256 gamma =
+  17449622659453764684681841929444256975795972822223845557918408663716231931237_u256;
+constexpr intx::uint256 delta =
+  18264928239209943763883705401737270632328147052232973765768550185180221261087_u256;
+constexpr intx::uint256 ic[] = {
+    2487805720119479121357182049761538101382351718876469637420372980304270200150_u256,
+    16287444439733288080638937111656860265494833094948812028956994392112518145362_u256,
+    8941297589864208901584530258401730893558662070391889156933606624243741828434_u256,
+    13960295159203248054035743642179912802930853605073778329562015699368300153883_u256,
+};
+
+} // namespace groth16
+
+// s * G1
+inline eosio::g1_point
+g1(const intx::uint256& s)
+{
+    std::vector<char> generator(64);
+    intx::be::unsafe::store((uint8_t*)generator.data(), intx::uint256{ 1 });
+    intx::be::unsafe::store((uint8_t*)generator.data() + 32,
+                            intx::uint256{ 2 });
+
+    eosio::bigint scalar(32);
+    intx::be::unsafe::store((uint8_t*)scalar.data(), s);
+
+    return eosio::alt_bn128_mul(eosio::g1_point(generator.data()), scalar);
+}
+
+} // namespace test_vk
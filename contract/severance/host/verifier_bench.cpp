@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Native timings of the withdraw proof verification and the deposit Merkle
+// insertion. The alt_bn128 host functions are the software stand-ins, so
+// only the time spent outside of them is representative of the chain; run
+// under perf to split the two.
+
+#include <chrono>
+#include <constants.hpp>
+#include <cstdio>
+#include <eosio/eosio.hpp>
+#include <fflonk_verifier.hpp>
+#include <groth16_verifier.hpp>
+#include <host.hpp>
+#include <merkle.hpp>
+#include <profile.hpp>
+#include <test_fflonk_prover.hpp>
+#include <test_groth16_prover.hpp>
+#include <test_prover.hpp>
+#include <verifier.hpp>
+
+static const int RUNS = 5;
+
+// Best of RUNS, in us per call.
+template<typename F>
+static double
+measure(int calls, F&& f)
+{
+    double best = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < calls; ++i)
+            f();
+        const auto end = std::chrono::steady_clock::now();
+        const double t =
+          std::chrono::duration<double, std::micro>(end - start).count();
+        if (run == 0 || t < best)
+            best = t;
+    }
+    return best / calls;
+}
+
+template<typename F>
+static void
+print_calls(const char* what, F&& f)
+{
+    const host::call_counts_t before = host::call_counts;
+    f();
+    const host::call_counts_t& after = host::call_counts;
+    printf("%-22s add %4llu mul %4llu pair %2llu keccak %3llu\n",
+           what,
+           (unsigned long long)(after.alt_bn128_add - before.alt_bn128_add),
+           (unsigned long long)(after.alt_bn128_mul - before.alt_bn128_mul),
+           (unsigned long long)(after.alt_bn128_pair - before.alt_bn128_pair),
+           (unsigned long long)(after.keccak - before.keccak));
+}
+
+#if defined(SEVERANCE_PROFILE)
+// Operation counts and time of each verifier stage in one call of f.
+template<typename F>
+static void
+print_stages(const char* what, F&& f)
+{
+    profile::reset();
+    f();
+    profile::switch_to(profile::STAGE_OTHER);
+
+    printf("%s\n", what);
+    for (const auto& s : profile::report()) {
+        printf("  %-11s mul %6u inv %2u add %3u g1mul %3u pair %u "
+               "keccak %2u %10.1f us\n",
+               s.stage.c_str(),
+               s.field_mul,
+               s.field_inv,
+               s.alt_bn128_add,
+               s.alt_bn128_mul,
+               s.alt_bn128_pair,
+               s.keccak,
+               s.ns / 1000.0);
+    }
+}
+#endif
+
+int
+main()
+{
+    test_vk::prover prover(1);
+    std::vector<std::vector<char>> input_data;
+    for (int i = 0; i < PUBLIC; ++i)
+        input_data.push_back(prover.random_input());
+    const withdraw_inputs inputs = test_vk::to_withdraw_inputs(input_data);
+    const withdraw_proof data =
+      test_vk::to_withdraw_proof(prover.prove(input_data));
+
+    proof_t proof;
+    if (!load_proof(data, proof) || !isValidProof(proof, inputs)) {
+        printf("test proof rejected\n");
+        return 1;
+    }
+
+    print_calls("isValidProof", [&] { isValidProof(proof, inputs); });
+    const double t_verify =
+      measure(10, [&] { isValidProof(proof, inputs); });
+
+    const fflonk_proof ff_proof = test_vk::fflonk_prover(1).prove(inputs);
+    if (!isValidFflonkProof(ff_proof, inputs)) {
+        printf("test fflonk proof rejected\n");
+        return 1;
+    }
+    print_calls("isValidFflonkProof",
+                [&] { isValidFflonkProof(ff_proof, inputs); });
+    const double t_fflonk =
+      measure(10, [&] { isValidFflonkProof(ff_proof, inputs); });
+
+    const groth16_proof g16_proof = test_vk::groth16_prover(1).prove(inputs);
+    if (!isValidGroth16Proof(g16_proof, inputs)) {
+        printf("test groth16 proof rejected\n");
+        return 1;
+    }
+    print_calls("isValidGroth16Proof",
+                [&] { isValidGroth16Proof(g16_proof, inputs); });
+    const double t_groth16 =
+      measure(10, [&] { isValidGroth16Proof(g16_proof, inputs); });
+
+    const eosio::g2_point g2 = host::make_g2_point(G2x1, G2x2, G2y1, G2y2);
+    std::vector<std::pair<eosio::g1_point, eosio::g2_point>> pairs;
+    const eosio::g1_point A(data.A.data());
+    const eosio::g1_point B(data.B.data());
+    pairs.push_back(std::make_pair(A, g2));
+    pairs.push_back(std::make_pair(B, g2));
+    const double t_pair =
+      measure(10, [&] { eosio::alt_bn128_pair(pairs); });
+
+    eosio::bigint s(32, 0x5a);
+    const double t_mul =
+      measure(100, [&] { eosio::alt_bn128_mul(A, s); });
+
+    // Deposits into a fresh tree, the stored nodes in a plain array.
+    Fr last_level_hash[MERKLE_HEIGHT];
+    uint32_t index = 0;
+    const Fr leaf = Fr::from_uint256(0x1234567890abcdef);
+    const double t_insert = measure(1000, [&] {
+        merkle_insert(
+          leaf,
+          index++,
+          [&](int level) { return last_level_hash[level]; },
+          [&](int level, const Fr& hash) { last_level_hash[level] = hash; });
+    });
+
+    // Batches of K copies of the proof; the cost does not depend on the
+    // proofs being distinct.
+    for (int k : { 1, 4, 16, 64 }) {
+        const std::vector<proof_t> proofs(k, proof);
+        const std::vector<const withdraw_inputs*> batch_inputs(k, &inputs);
+        const auto batch = [&] {
+            isValidProofBatch(proofs.data(), batch_inputs.data(), k);
+        };
+        char label[32];
+        snprintf(label, sizeof(label), "isValidProofBatch x%d", k);
+        print_calls(label, batch);
+        const double t = measure(1, batch);
+        printf("%-22s %10.1f us per proof\n", label, t / k);
+    }
+
+#if defined(SEVERANCE_PROFILE)
+    print_stages("isValidProof", [&] { isValidProof(proof, inputs); });
+    print_stages("isValidFflonkProof",
+                 [&] { isValidFflonkProof(ff_proof, inputs); });
+    print_stages("isValidGroth16Proof",
+                 [&] { isValidGroth16Proof(g16_proof, inputs); });
+#endif
+
+    printf("isValidProof      %10.1f us\n", t_verify);
+    printf("isValidFflonkProof %9.1f us\n", t_fflonk);
+    printf("isValidGroth16Proof %8.1f us\n", t_groth16);
+    printf("alt_bn128_pair x2 %10.1f us\n", t_pair);
+    printf("alt_bn128_mul     %10.1f us\n", t_mul);
+    printf("merkle_insert     %10.1f us\n", t_insert);
+
+    return 0;
+}
@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Native checks of the software alt_bn128 and Keccak backend and of the
+// whole isValidProof pipeline, against proofs made from the trapdoor of the
+// test verification key.
+
+#include <algorithm>
+#include <constants.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fflonk_verifier.hpp>
+#include <groth16_verifier.hpp>
+#include <eosio/eosio.hpp>
+#include <host.hpp>
+#include <intx.h>
+#include <new>
+#include <test_fflonk_prover.hpp>
+#include <test_groth16_prover.hpp>
+#include <test_prover.hpp>
+#include <transcript.hpp>
+#include <verifier.hpp>
+
+using namespace intx;
+
+static int failures = 0;
+
+// Heap allocations so far, to check that the verifiers make none.
+static size_t allocations = 0;
+
+// Both sides are malloc and free, but GCC sees free() called on what a new
+// expression returned, once these are inlined, and warns of a mismatch.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void*
+operator new(size_t size)
+{
+    allocations++;
+    if (void* p = malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void
+operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+static void
+expect(bool ok, const char* what)
+{
+    if (ok)
+        return;
+    printf("FAIL %s\n", what);
+    failures++;
+}
+
+static bool
+verify(const withdraw_proof& data, const withdraw_inputs& inputs)
+{
+    proof_t proof;
+    return load_proof(data, proof) && isValidProof(proof, inputs);
+}
+
+static bool
+verify_batch(const std::vector<withdraw_proof>& data,
+             const std::vector<withdraw_inputs>& inputs)
+{
+    std::vector<proof_t> proofs(data.size());
+    std::vector<const withdraw_inputs*> input_ptrs(data.size());
+    for (size_t k = 0; k < data.size(); ++k) {
+        if (!load_proof(data[k], proofs[k]))
+            return false;
+        input_ptrs[k] = &inputs[k];
+    }
+    return isValidProofBatch(proofs.data(), input_ptrs.data(), data.size());
+}
+
+static eosio::bigint
+scalar(const uint256& s)
+{
+    eosio::bigint r(32);
+    be::unsafe::store((uint8_t*)r.data(), s);
+    return r;
+}
+
+static void
+check_keccak()
+{
+    const uint8_t empty[32] = {
+        0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d,
+        0xb2, 0xdc, 0xc7, 0x03, 0xc0, 0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82,
+        0x27, 0x3b, 0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70
+    };
+    const auto digest = eosio::keccak("", 0).extract_as_byte_array();
+    expect(std::equal(digest.begin(), digest.end(), empty), "keccak(\"\")");
+}
+
+// The streaming and the buffered backends agree with one-shot keccak, for
+// rounds across the 136-byte block boundary absorbed in uneven pieces.
+static void
+check_transcript()
+{
+    char data[400];
+    for (int i = 0; i < 400; ++i)
+        data[i] = (char)(i * 7 + 1);
+
+    basic_transcript<host::keccak_sponge> streamed;
+    basic_transcript<keccak_buffer<400>> buffered;
+    for (int size : { 0, 32, 135, 136, 137, 272, 400 }) {
+        for (int i = 0; i < size; i += 45) {
+            const int n = std::min(45, size - i);
+            streamed.absorb(data + i, n);
+            buffered.absorb(data + i, n);
+        }
+        const auto digest = eosio::keccak(data, size).extract_as_byte_array();
+        const Fr expected = Fr::load(digest.data());
+        expect(streamed.squeeze() == expected, "streamed transcript");
+        expect(buffered.squeeze() == expected, "buffered transcript");
+    }
+}
+
+static void
+check_alt_bn128()
+{
+    const eosio::g1_point g1 = host::make_g1_point(1, 2);
+    const eosio::g2_point g2 = host::make_g2_point(G2x1, G2x2, G2y1, G2y2);
+    const uint256 a = 0x1234567890abcdef;
+    const uint256 b = 0xfedcba0987654321;
+
+    const auto a_g1 = eosio::alt_bn128_mul(g1, scalar(a));
+    expect(eosio::alt_bn128_add(a_g1, a_g1).serialized() ==
+             eosio::alt_bn128_mul(g1, scalar(2 * a)).serialized(),
+           "alt_bn128_add doubling");
+    expect(eosio::alt_bn128_mul(g1, scalar(q)).serialized() ==
+             std::vector<char>(64, 0),
+           "q * G1 is the identity");
+
+    // e(a G1, b G2) * e(-ab G1, G2) == 1
+    const auto b_g2 = host::g2_mul(g2, b);
+    const auto ab_g1 = eosio::alt_bn128_mul(g1, scalar(q - mulmod(a, b, q)));
+    std::vector<std::pair<eosio::g1_point, eosio::g2_point>> pairs;
+    pairs.push_back(std::make_pair(a_g1, b_g2));
+    pairs.push_back(std::make_pair(ab_g1, g2));
+    expect(eosio::alt_bn128_pair(pairs) == 0, "pairing bilinearity");
+
+    pairs.pop_back();
+    expect(eosio::alt_bn128_pair(pairs) == 1, "pairing non-degeneracy");
+
+    std::vector<char> off_curve = g1.serialized();
+    off_curve[63] ^= 1;
+    char out[64];
+    expect(eosio::alt_bn128_add(
+             off_curve.data(), 64, off_curve.data(), 64, out, 64) == -1,
+           "alt_bn128_add rejects points off the curve");
+}
+
+// Random public inputs of the test prover of a seed, and the proof of each
+// proof system for them.
+class fixture
+{
+  public:
+    explicit fixture(uint64_t seed)
+      : seed(seed)
+      , prover(seed)
+    {
+        for (int i = 0; i < PUBLIC; ++i)
+            input_data.push_back(prover.random_input());
+        inputs = test_vk::to_withdraw_inputs(input_data);
+    }
+
+    withdraw_proof plonk()
+    {
+        return test_vk::to_withdraw_proof(prover.prove(input_data));
+    }
+
+    fflonk_proof fflonk() const
+    {
+        return test_vk::fflonk_prover(seed).prove(inputs);
+    }
+
+    groth16_proof groth16() const
+    {
+        return test_vk::groth16_prover(seed).prove(inputs);
+    }
+
+    withdraw_inputs inputs;
+
+  private:
+    uint64_t seed;
+    test_vk::prover prover;
+    std::vector<std::vector<char>> input_data;
+};
+
+static void
+check_proofs()
+{
+    for (uint64_t seed = 1; seed <= 3; ++seed) {
+        fixture f(seed);
+        const withdraw_inputs& inputs = f.inputs;
+        const withdraw_proof data = f.plonk();
+
+        expect(verify(data, inputs), "valid proof");
+
+        auto other_inputs = inputs;
+        other_inputs.recipient[31] ^= 1;
+        expect(!verify(data, other_inputs), "proof for other public inputs");
+
+        auto bad_eval = data;
+        bad_eval.eval_r[31] ^= 1;
+        expect(!verify(bad_eval, inputs), "proof with a wrong evaluation");
+
+        // The same evaluation plus q hashes differently; it is refused
+        // before it reaches the transcript.
+        auto unreduced = data;
+        const uint256 e =
+          be::unsafe::load<uint256>((uint8_t*)data.eval_a.data());
+        if (e < ~uint256{ 0 } - q) {
+            be::unsafe::store((uint8_t*)unreduced.eval_a.data(), e + q);
+            proof_t proof;
+            expect(!load_proof(unreduced, proof), "unreduced evaluation");
+        }
+
+        auto bad_opening = data;
+        std::swap(bad_opening.Wxi, bad_opening.Wxiw);
+        expect(!verify(bad_opening, inputs), "proof with wrong openings");
+
+        auto off_curve = data;
+        off_curve.Z[63] ^= 1;
+        proof_t proof;
+        expect(!load_proof(off_curve, proof), "point off the curve");
+    }
+}
+
+static void
+check_compressed()
+{
+    fixture f(4);
+    const withdraw_inputs& inputs = f.inputs;
+    const withdraw_proof data = f.plonk();
+
+    const withdraw_proof_compressed compressed = compress_proof(data);
+    withdraw_proof decompressed;
+    expect(decompress_proof(compressed, decompressed) &&
+             memcmp(&decompressed, &data, sizeof(data)) == 0,
+           "proof compression round trip");
+
+    // Both signs of y, and the point at infinity.
+    char points[3][64] = {};
+    const eosio::g1_point g1 = host::make_g1_point(1, 2);
+    const auto minus_g1 = eosio::alt_bn128_mul(g1, scalar(q - 1));
+    memcpy(points[0], g1.serialized().data(), 64);
+    memcpy(points[1], minus_g1.serialized().data(), 64);
+    for (const auto& p : points) {
+        char out[64];
+        expect(g1_decompress(g1_compress(p), out) && memcmp(out, p, 64) == 0,
+               "point compression round trip");
+    }
+
+    // The other sign is -P, so a valid proof fails.
+    auto flipped = compressed;
+    flipped.C[0] ^= G1_COMPRESSED_ODD;
+    expect(decompress_proof(flipped, decompressed) &&
+             !verify(decompressed, inputs),
+           "compressed proof with a flipped sign");
+
+    // x = 0 gives y^2 = 3, not a square mod q.
+    g1_compressed_t off_curve = {};
+    char out[64];
+    expect(!g1_decompress(off_curve, out), "x off the curve");
+
+    g1_compressed_t unreduced;
+    be::unsafe::store((uint8_t*)unreduced.data(), qf + 1);
+    expect(!g1_decompress(unreduced, out), "x not below q");
+
+    g1_compressed_t bad_infinity = {};
+    bad_infinity[0] = G1_COMPRESSED_INFINITY;
+    bad_infinity[31] = 1;
+    expect(!g1_decompress(bad_infinity, out), "infinity with an x");
+}
+
+static void
+check_batches()
+{
+    std::vector<withdraw_proof> proofs;
+    std::vector<withdraw_inputs> inputs;
+    for (uint64_t seed = 10; seed < 14; ++seed) {
+        fixture f(seed);
+        inputs.push_back(f.inputs);
+        proofs.push_back(f.plonk());
+    }
+
+    expect(verify_batch(proofs, inputs), "valid batch");
+    expect(verify_batch({ proofs[0] }, { inputs[0] }), "valid batch of one");
+    expect(!verify_batch({}, {}), "empty batch");
+
+    // One bad proof fails the batch, wherever it is.
+    for (size_t k = 0; k < proofs.size(); ++k) {
+        auto bad_inputs = inputs;
+        bad_inputs[k].root_hash[31] ^= 1;
+        expect(!verify_batch(proofs, bad_inputs),
+               "batch with one proof for other inputs");
+    }
+
+    // Two proofs whose errors would cancel out in an unweighted sum.
+    auto swapped = proofs;
+    std::swap(swapped[1].Wxi, swapped[2].Wxi);
+    expect(!verify_batch(swapped, inputs), "batch with exchanged openings");
+}
+
+// Proofs of the test prover, which follows the verifier's reading of
+// snarkjs. fflonk_snarkjs_test checks against snarkjs itself.
+static void
+check_fflonk()
+{
+    for (uint64_t seed = 1; seed <= 3; ++seed) {
+        const fixture f(seed);
+        const withdraw_inputs& inputs = f.inputs;
+        const fflonk_proof proof = f.fflonk();
+
+        expect(isValidFflonkProof(proof, inputs), "valid fflonk proof");
+
+        auto other_inputs = inputs;
+        other_inputs.nullifier_hash[31] ^= 1;
+        expect(!isValidFflonkProof(proof, other_inputs),
+               "fflonk proof for other public inputs");
+
+        // Each evaluation enters a different opening.
+        for (auto eval : { &fflonk_proof::eval_qm,
+                           &fflonk_proof::eval_c,
+                           &fflonk_proof::eval_zw }) {
+            auto bad_eval = proof;
+            (bad_eval.*eval)[31] ^= 1;
+            expect(!isValidFflonkProof(bad_eval, inputs),
+                   "fflonk proof with a wrong evaluation");
+        }
+
+        auto bad_opening = proof;
+        std::swap(bad_opening.W1, bad_opening.W2);
+        expect(!isValidFflonkProof(bad_opening, inputs),
+               "fflonk proof with wrong openings");
+
+        auto unreduced = proof;
+        const uint256 e =
+          be::unsafe::load<uint256>((uint8_t*)proof.eval_a.data());
+        if (e < ~uint256{ 0 } - q) {
+            be::unsafe::store((uint8_t*)unreduced.eval_a.data(), e + q);
+            expect(!isValidFflonkProof(unreduced, inputs),
+                   "fflonk unreduced evaluation");
+        }
+
+        expect(isWellFormedFflonkProof(proof), "well formed fflonk proof");
+        auto off_curve = proof;
+        off_curve.W1[63] ^= 1;
+        expect(!isWellFormedFflonkProof(off_curve),
+               "fflonk point off the curve");
+
+        // Ignoring the hint is sound: snarkjs computes inv after its last
+        // challenge and does not hash it, so it cannot steer the transcript,
+        // and the verifier computes its own inverses instead of trusting it.
+        auto other_inv = proof;
+        other_inv.eval_inv[31] ^= 1;
+        expect(isValidFflonkProof(other_inv, inputs),
+               "fflonk proof with another inverse hint");
+    }
+}
+
+static void
+check_groth16()
+{
+    for (uint64_t seed = 1; seed <= 3; ++seed) {
+        const fixture f(seed);
+        const withdraw_inputs& inputs = f.inputs;
+        const groth16_proof proof = f.groth16();
+
+        expect(isValidGroth16Proof(proof, inputs), "valid groth16 proof");
+
+        for (int i = 0; i < PUBLIC; ++i) {
+            auto other_inputs = inputs;
+            ((char*)&other_inputs)[32 * i + 31] ^= 1;
+            expect(!isValidGroth16Proof(proof, other_inputs),
+                   "groth16 proof for other public inputs");
+        }
+
+        // input + q is the same scalar to the multiplication.
+        auto unreduced = inputs;
+        const uint256 r =
+          be::unsafe::load<uint256>((uint8_t*)inputs.recipient.data());
+        if (r < ~uint256{ 0 } - q) {
+            be::unsafe::store((uint8_t*)unreduced.recipient.data(), r + q);
+            expect(!isValidGroth16Proof(proof, unreduced),
+                   "groth16 unreduced public input");
+        }
+
+        expect(isWellFormedGroth16Proof(proof), "well formed groth16 proof");
+        auto off_curve = proof;
+        off_curve.C[63] ^= 1;
+        expect(!isWellFormedGroth16Proof(off_curve),
+               "groth16 point off the curve");
+        auto unreduced_b = proof;
+        be::unsafe::store((uint8_t*)unreduced_b.B.data(), qf);
+        expect(!isWellFormedGroth16Proof(unreduced_b),
+               "groth16 coordinate not below q");
+
+        auto bad_proof = proof;
+        std::swap(bad_proof.A, bad_proof.C);
+        expect(!isValidGroth16Proof(bad_proof, inputs),
+               "groth16 proof with exchanged points");
+    }
+}
+
+// The verifiers run on fixed-size buffers and the raw host functions, so
+// an action's memory does not grow with them.
+static void
+check_allocations()
+{
+    fixture f(5);
+    const withdraw_inputs& inputs = f.inputs;
+    const withdraw_proof_compressed compressed = compress_proof(f.plonk());
+    const fflonk_proof ff_proof = f.fflonk();
+    const groth16_proof g16_proof = f.groth16();
+
+    const size_t before = allocations;
+    withdraw_proof decompressed;
+    proof_t proof;
+    const bool valid = decompress_proof(compressed, decompressed) &&
+                       load_proof(decompressed, proof) &&
+                       isValidProof(proof, inputs) &&
+                       isValidFflonkProof(ff_proof, inputs) &&
+                       isValidGroth16Proof(g16_proof, inputs);
+    expect(valid, "valid proofs");
+    expect(allocations == before, "verifiers allocate no memory");
+}
+
+int
+main()
+{
+    check_keccak();
+    check_transcript();
+    check_alt_bn128();
+    check_proofs();
+    check_compressed();
+    check_batches();
+    check_fflonk();
+    check_groth16();
+    check_allocations();
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("all checks pass\n");
+    return 0;
+}
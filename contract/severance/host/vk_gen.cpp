@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Writes the header a verifier includes as its verification key, from the
+// verification_key.json of snarkjs:
+//
+//   vk_gen verification_key.json include/verification_key.hpp
+//
+// The protocol field selects the header, verification_key.hpp for plonk,
+// fflonk_verification_key.hpp for fflonk and groth16_verification_key.hpp
+// for groth16. Points are written in the byte layout of the alt_bn128 host
+// functions, the G2 points the pairing checks take negated, and field
+// elements in Montgomery form, so the verifiers derive nothing from the key
+// at run time.
+
+#include <constants.hpp>
+#include <cstdio>
+#include <cstring>
+#include <field.hpp>
+#include <fstream>
+#include <intx.h>
+#include <iostream>
+#include <json.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using intx::uint256;
+
+static uint256
+number(const json& v)
+{
+    return intx::from_string<uint256>(v.text);
+}
+
+static std::string
+hex(const uint256& x)
+{
+    std::string r = intx::hex(x);
+    return std::string(64 - r.size(), '0') + r;
+}
+
+// A scalar below q, in Montgomery form.
+static std::string
+fr(const json& v)
+{
+    const uint256 x = number(v);
+    if (x >= q)
+        throw std::runtime_error("scalar not below q: " + v.text);
+    return "Fr::from_montgomery(\n  0x" +
+           hex(Fr::from_uint256(x).montgomery()) + "_u256)";
+}
+
+static uint256
+coordinate(const json& v)
+{
+    const uint256 x = number(v);
+    if (x >= qf)
+        throw std::runtime_error("coordinate not below q: " + v.text);
+    return x;
+}
+
+// [x, y, z] with z = 1, or z = 0 for the point at infinity.
+static std::string
+g1(const json& v)
+{
+    if (number(v[2]) == 0)
+        return hex(0) + hex(0);
+
+    const uint256 x = coordinate(v[0]);
+    const uint256 y = coordinate(v[1]);
+    const Fq fx = Fq::from_uint256(x);
+    if (Fq::from_uint256(y).square() !=
+        fx.square() * fx + Fq::from_uint256(3))
+        throw std::runtime_error("G1 point not on the curve");
+    return hex(x) + hex(y);
+}
+
+// -[[x.c0, x.c1], [y.c0, y.c1], [1, 0]], imaginary parts first as the
+// host functions take them.
+static std::string
+g2_neg(const json& v)
+{
+    if (number(v[2][0]) == 0 && number(v[2][1]) == 0)
+        return hex(0) + hex(0) + hex(0) + hex(0);
+
+    const auto neg = [](const uint256& c) { return c == 0 ? c : qf - c; };
+    return hex(coordinate(v[0][1])) + hex(coordinate(v[0][0])) +
+           hex(neg(coordinate(v[1][1]))) + hex(neg(coordinate(v[1][0])));
+}
+
+// hex_bytes() over 64 digits per line.
+static std::string
+bytes(const std::string& digits, const char* indent = "  ")
+{
+    std::string r = "hex_bytes(";
+    for (size_t i = 0; i < digits.size(); i += 64)
+        r += "\n" + std::string(indent) + "\"" + digits.substr(i, 64) + "\"";
+    return r + ")";
+}
+
+class header
+{
+  public:
+    explicit header(const std::string& protocol)
+    {
+        out << "// Generated by vk_gen from a snarkjs " << protocol
+            << " verification key. Do not edit.\n\n"
+            << "#pragma once\n\n"
+            << "#include <curve.hpp>\n"
+            << "#include <field.hpp>\n"
+            << "#include <intx.h>\n\n"
+            << "using namespace intx::literals;\n\n";
+    }
+
+    void comment(const std::string& text) { out << "// " << text << "\n"; }
+
+    void integer(const char* name, const json& v)
+    {
+        out << "constexpr int " << name << " = " << std::stoi(v.text)
+            << ";\n";
+    }
+
+    void scalar(const char* name, const json& v)
+    {
+        out << "constexpr Fr " << name << " = " << fr(v) << ";\n";
+    }
+
+    void point(const char* type, const std::string& name, const std::string& d)
+    {
+        out << "constexpr " << type << " " << name << " = " << bytes(d)
+            << ";\n";
+    }
+
+    void g1_array(const std::string& name, const std::vector<json>& points)
+    {
+        out << "constexpr g1_data_t " << name << "[] = {";
+        for (const json& p : points)
+            out << "\n  " << bytes(g1(p), "    ") << ",";
+        out << "\n};\n";
+    }
+
+    void blank() { out << "\n"; }
+
+    std::string str() const { return out.str(); }
+
+  private:
+    std::ostringstream out;
+};
+
+static void
+domain(header& h, const json& vk)
+{
+    h.integer("VK_PUBLIC", vk["nPublic"]);
+    h.integer("POWER", vk["power"]);
+    h.blank();
+    h.comment("Generator of the evaluation domain and the coset shifts.");
+    h.scalar("w1", vk["w"]);
+    h.scalar("k1", vk["k1"]);
+    h.scalar("k2", vk["k2"]);
+    h.blank();
+}
+
+static std::string
+plonk(const json& vk)
+{
+    header h("PLONK");
+    domain(h, vk);
+    for (const char* name : { "Qm", "Ql", "Qr", "Qo", "Qc", "S1", "S2", "S3" })
+        h.point("g1_data_t", name, g1(vk[name]));
+    h.blank();
+    h.point("g2_data_t", "X2_neg", g2_neg(vk["X_2"]));
+    return h.str();
+}
+
+static std::string
+fflonk(const json& vk)
+{
+    header h("FFLONK");
+    domain(h, vk);
+    h.comment("Roots of unity of order 3, 4 and 8, and a cube root of w1.");
+    for (const char* name : { "w3", "w4", "w8", "wr" })
+        h.scalar(name, vk[name]);
+    h.blank();
+    h.point("g1_data_t", "C0", g1(vk["C0"]));
+    h.point("g2_data_t", "X2_neg", g2_neg(vk["X_2"]));
+    return h.str();
+}
+
+static std::string
+groth16(const json& vk)
+{
+    header h("Groth16");
+    h.integer("VK_PUBLIC", vk["nPublic"]);
+    h.blank();
+    h.point("g1_data_t", "alpha1", g1(vk["vk_alpha_1"]));
+    h.point("g2_data_t", "beta2_neg", g2_neg(vk["vk_beta_2"]));
+    h.point("g2_data_t", "gamma2_neg", g2_neg(vk["vk_gamma_2"]));
+    h.point("g2_data_t", "delta2_neg", g2_neg(vk["vk_delta_2"]));
+    h.blank();
+    const json& ic = vk["IC"];
+    if (ic.items.size() != (size_t)std::stoi(vk["nPublic"].text) + 1)
+        throw std::runtime_error("IC does not match nPublic");
+    h.comment("L = IC[0] + sum input_i IC[i + 1]");
+    h.g1_array("IC", ic.items);
+    return h.str();
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc != 2 && argc != 3) {
+        fprintf(stderr, "usage: %s verification_key.json [header]\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        const json vk = read_json(argv[1]);
+
+        if (vk.fields.count("curve") && vk["curve"].text != "bn128")
+            throw std::runtime_error("not a bn128 key");
+        const std::string& protocol = vk["protocol"].text;
+        std::string out;
+        if (protocol == "plonk")
+            out = plonk(vk);
+        else if (protocol == "fflonk")
+            out = fflonk(vk);
+        else if (protocol == "groth16")
+            out = groth16(vk);
+        else
+            throw std::runtime_error("unknown protocol " + protocol);
+
+        if (argc == 3) {
+            std::ofstream file(argv[2]);
+            file << out;
+            if (!file)
+                throw std::runtime_error(std::string("cannot write ") +
+                                         argv[2]);
+        } else {
+            std::cout << out;
+        }
+    } catch (const std::exception& e) {
+        fprintf(stderr, "vk_gen: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -26,20 +26,61 @@
 
 using namespace intx::literals;
 
-const uint8_t MERKLE_HEIGHT = 31;
+// All constexpr, so that none is parsed from its digits when an action
+// starts.
 
-const intx::uint256 q =
+constexpr uint8_t MERKLE_HEIGHT = 31;
+
+constexpr intx::uint256 q =
   21888242871839275222246405745257275088548364400416034343698204186575808495617_u256;
-const intx::uint256 qf =
+constexpr intx::uint256 qf =
   21888242871839275222246405745257275088696311157297823662689037894645226208583_u256;
 
-const uint16_t PUBLIC = 3;
+constexpr uint16_t PUBLIC = 3;
+
+// Per level hash of an empty subtree, used as the sibling of a left child
+// until its right neighbour is inserted. Values at or above q are reduced
+// when they are loaded into the field.
+constexpr intx::uint256 level_defaults[32] = {
+    30238598704088929952843927706569847911599885956104611274912160341490286246718_u256,
+    25348422377004321007059927731081793746945139569114277883447014548301570270860_u256,
+    16401820946464185137346357874373090990568111992633083038764169830345921227085_u256,
+    7508103525080351137382699802863531575643180572162613318007798684988341228268_u256,
+    17960896985569549954477100205393164871173002812946988710438960683597028440922_u256,
+    29464911409920719015583702742677733245455761112275208147876304472374171736419_u256,
+    20365738626542439140784808616660262904197432804351602887389291635706005230479_u256,
+    50094012655666739741757742535708299725511612220888959669209674245779430795631_u256,
+    84481084991077554297473579297547823130151822028357513698940834088946031994428_u256,
+    65009568646014927574600477453219176146218298364363007468316186649830384869270_u256,
+    74568519575760023398099891318741317344911244404916721780423199270529518060223_u256,
+    28474002570249281395440345236610297023194847909993280485202899395592828940126_u256,
+    40230313923982849562834343028524642933574573334910634629678156674487064379057_u256,
+    16463665069615288234635515866443739209783239800818597114164287502048789052464_u256,
+    39326964221197219404313764098995068225350845039661696346190141178267408599237_u256,
+    56128881384580835253363759507703601545282399300749662091723162625648919231395_u256,
+    71651674210086931308216423199077829219568676225701481144725097391774503208581_u256,
+    11291812394179869221746248061886328562378471618543727288534038397673199316212_u256,
+    91768241568601166219390796547719868152960074702606000299649710606134403570387_u256,
+    113866854053749903300333619484139229603952452549894060841070478621193462325348_u256,
+    12900939506777163752908550726884953820264260341613592165124627336667450505012_u256,
+    77792729128822647523914437850871477814352129948361548129548545876643770001468_u256,
+    8550899905673560156874502538901844408321725334814212168646676121448800494749_u256,
+    68075794184097345106241543125282550400004595546658124757342479691208462448155_u256,
+    52051519765640516569026227651220681577251574921757729650704331930922152451705_u256,
+    60439906622495289412129553804980598395101411861085333741828968014406524398960_u256,
+    43838341704056268159122126764160763495039233876411520978708515517865358045820_u256,
+    20769327482353150733803221965915847256410246352105945946711490529511199296334_u256,
+    90854336653446787628791047493176183662724257943649508657425729023284934684385_u256,
+    104113848206815522990854469768913042028817956314155575532193413111187726944706_u256,
+    99687557887186228995941237085927827806810202766788290430077136634416942660613_u256,
+    7333656426618417692843107199562353793827654602322450949288455009300229501943_u256
+};
 
-const intx::uint256 G2x1 =
+constexpr intx::uint256 G2x1 =
   10857046999023057135944570762232829481370756359578518086990519993285655852781_u256;
-const intx::uint256 G2x2 =
+constexpr intx::uint256 G2x2 =
   11559732032986387107991004021392285783925812861821192530917403151452391805634_u256;
-const intx::uint256 G2y1 =
+constexpr intx::uint256 G2y1 =
   8495653923123431417604973247489272438418190587263600148770280649306958101930_u256;
-const intx::uint256 G2y2 =
+constexpr intx::uint256 G2y2 =
   4082367875863433681332203403145435568316851327593401208105741076214120093531_u256;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <eosio/crypto_ext.hpp>
+#include <field.hpp>
+#include <intx.h>
+
+// G1 arithmetic and the pairing check over the raw alt_bn128 host
+// functions. Points are kept as the host functions take them, 64-byte x, y
+// buffers for G1 and 128-byte buffers for G2, so nothing is allocated.
+typedef std::array<char, 64> g1_data_t;
+typedef std::array<char, 128> g2_data_t;
+
+constexpr int
+hex_digit(char c)
+{
+    return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+}
+
+// The bytes of a string literal of hex digits, for the point tables of the
+// keys vk_gen writes. Evaluated by the compiler, so the tables need no
+// initialization code.
+template<std::size_t N>
+constexpr std::array<char, (N - 1) / 2>
+hex_bytes(const char (&hex)[N])
+{
+    static_assert(N % 2 == 1, "odd number of hex digits");
+    std::array<char, (N - 1) / 2> r{};
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        r[i] = (char)(hex_digit(hex[2 * i]) << 4 | hex_digit(hex[2 * i + 1]));
+    }
+    return r;
+}
+
+// Stores x big endian, byte by byte so that it can run at compile time.
+constexpr void
+store_be(char* dst, const intx::uint256& x)
+{
+    for (int i = 0; i < 32; ++i) {
+        dst[31 - i] = (char)(x[i / 8] >> (8 * (i % 8)));
+    }
+}
+
+// The same points built straight into their buffers, as constants.
+constexpr g1_data_t
+make_g1_data(const intx::uint256& x, const intx::uint256& y)
+{
+    g1_data_t r{};
+    store_be(&r[0], x);
+    store_be(&r[32], y);
+    return r;
+}
+
+constexpr g2_data_t
+make_g2_data(const intx::uint256& x1,
+             const intx::uint256& x2,
+             const intx::uint256& y1,
+             const intx::uint256& y2)
+{
+    g2_data_t r{};
+    store_be(&r[0], x2);
+    store_be(&r[32], x1);
+    store_be(&r[64], y2);
+    store_be(&r[96], y1);
+    return r;
+}
+
+void
+g1_mul(const char* p, const Fr& s, char* result);
+void
+g1_add(const char* a, const char* b, char* result);
+
+// A G1 point compressed to its x coordinate. The top bits of the first
+// byte, free as q < 2^254, flag an odd y and the point at infinity; the
+// rest of an infinity must be zero.
+typedef std::array<char, 32> g1_compressed_t;
+
+const uint8_t G1_COMPRESSED_ODD = 0x80;
+const uint8_t G1_COMPRESSED_INFINITY = 0x40;
+
+g1_compressed_t
+g1_compress(const char* p);
+
+// Recovers y from y^2 = x^3 + 3. Fails if x is not below q or is not on the
+// curve, or on a malformed infinity.
+bool
+g1_decompress(const g1_compressed_t& data, char* result);
+
+// Whether p is the point at infinity or its coordinates are below q and
+// satisfy y^2 = x^3 + 3. A few field multiplications, to turn bad points
+// away before any host call.
+bool
+g1_on_curve(const char* p);
+
+// Whether the coordinates of p are below q. The host functions still check
+// that it is on the curve and in the subgroup.
+bool
+g2_in_range(const char* p);
+
+// e(a1, x2_neg) * e(b1, G2) == 1
+bool
+pairing_check(const char* a1, const g2_data_t& x2_neg, const char* b1);
+
+// Loads a 32-byte big endian scalar that must be below q, for evaluations
+// that are hashed as sent and so must have a single encoding.
+bool
+load_canonical(const std::array<char, 32>& data, Fr& x);
+
+// Running sum of s * P. Zero scalars are skipped and a scalar of one costs
+// no multiplication. An empty sum is the point at infinity, (0, 0).
+class g1_sum
+{
+  public:
+    void add(const char* p, const Fr& s)
+    {
+        if (s.is_zero())
+            return;
+        char t[64];
+        if (s == Fr::one()) {
+            memcpy(t, p, 64);
+        } else {
+            g1_mul(p, s, t);
+        }
+        if (empty) {
+            memcpy(sum, t, 64);
+        } else {
+            g1_add(sum, t, sum);
+        }
+        empty = false;
+    }
+
+    const char* get() const { return sum; }
+
+  private:
+    char sum[64] = {};
+    bool empty = true;
+};
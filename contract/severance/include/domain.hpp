@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <field.hpp>
+#include <intx.h>
+#include <utility>
+
+// The evaluation domain of a circuit with 2^Power rows, generated by the
+// root of unity W, and the Lagrange polynomials of its Public inputs.
+//
+// What depends only on the circuit, n, 1/n and the w^i, is computed at
+// compile time, and the loops over the inputs and the squarings of xi^n are
+// unrolled. W is the constexpr w1 of the verification key.
+template<int Public, int Power, const Fr& W>
+class domain
+{
+    static_assert(Public >= 1, "no public inputs");
+    static_assert(Power >= 1 && Power <= 28, "unsupported domain size");
+
+    template<std::size_t... I>
+    static constexpr std::array<Fr, Public> powers(std::index_sequence<I...>)
+    {
+        return { { W.pow(I)... } };
+    }
+
+    template<std::size_t... I>
+    static constexpr Fr pow_n(Fr x, std::index_sequence<I...>)
+    {
+        ((x = x.square(), (void)I), ...);
+        return x;
+    }
+
+    template<std::size_t... I>
+    static constexpr void denominators(const Fr& xi,
+                                       Fr* den,
+                                       std::index_sequence<I...>)
+    {
+        ((den[I] = xi - w[I]), ...);
+    }
+
+    template<std::size_t... I>
+    static constexpr void lagrange(const Fr& zh_n,
+                                   const Fr* den_inv,
+                                   Fr* L,
+                                   std::index_sequence<0, I...>)
+    {
+        L[0] = zh_n * den_inv[0];
+        ((L[I] = w[I] * zh_n * den_inv[I]), ...);
+    }
+
+  public:
+    static constexpr Fr n = Fr::from_uint256(intx::uint256{ 1 } << Power);
+    static constexpr Fr n_inv = n.inv();
+
+    // w^0, ..., w^(Public - 1)
+    static constexpr std::array<Fr, Public> w =
+      powers(std::make_index_sequence<Public>());
+
+    // x^n
+    static constexpr Fr pow_n(const Fr& x)
+    {
+        return pow_n(x, std::make_index_sequence<Power>());
+    }
+
+    // den[i] = xi - w^i, for the caller to invert along with its own
+    // denominators.
+    static constexpr void lagrange_denominators(const Fr& xi, Fr* den)
+    {
+        denominators(xi, den, std::make_index_sequence<Public>());
+    }
+
+    // L_i(xi) = w^i zh / (n (xi - w^i)), given the inverted denominators.
+    static constexpr void lagrange(const Fr& zh, const Fr* den_inv, Fr* L)
+    {
+        lagrange(zh * n_inv, den_inv, L, std::make_index_sequence<Public>());
+    }
+};
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <verifier.hpp>
+
+// A snarkjs FFLONK proof of the withdraw circuit as it is laid out in the
+// action data: the commitments C1, C2, W1, W2 as x then y, and sixteen
+// evaluations, all 32-byte big endian numbers.
+//
+// eval_inv is the prover's hint for the Solidity verifier, the inverse of
+// the product of its denominators. It is not hashed and the verifier here
+// computes its own inverses, so it is ignored.
+struct fflonk_proof
+{
+    std::array<char, 64> C1;
+    std::array<char, 64> C2;
+    std::array<char, 64> W1;
+    std::array<char, 64> W2;
+    std::array<char, 32> eval_ql;
+    std::array<char, 32> eval_qr;
+    std::array<char, 32> eval_qm;
+    std::array<char, 32> eval_qo;
+    std::array<char, 32> eval_qc;
+    std::array<char, 32> eval_s1;
+    std::array<char, 32> eval_s2;
+    std::array<char, 32> eval_s3;
+    std::array<char, 32> eval_a;
+    std::array<char, 32> eval_b;
+    std::array<char, 32> eval_c;
+    std::array<char, 32> eval_z;
+    std::array<char, 32> eval_zw;
+    std::array<char, 32> eval_t1w;
+    std::array<char, 32> eval_t2w;
+    std::array<char, 32> eval_inv;
+};
+
+static_assert(sizeof(fflonk_proof) == 4 * 64 + 16 * 32, "padded proof");
+
+// Whether the commitments are on the curve and the evaluations below q,
+// checks that cost no host call.
+bool
+isWellFormedFflonkProof(const fflonk_proof& proof);
+
+// Five G1 multiplications and one pairing, where the PLONK verifier needs
+// eighteen multiplications. Fails on evaluations that are not below q.
+bool
+isValidFflonkProof(const fflonk_proof& proof,
+                   const withdraw_inputs& public_inputs);
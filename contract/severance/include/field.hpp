@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <intx.h>
+#include <type_traits>
+#include <vector>
+
+// Prime field arithmetic in Montgomery representation (R = 2^256).
+//
+// Values are kept as x * R mod p, so a multiplication is a single
+// Montgomery product instead of the 512-by-256 bit Knuth division
+// that intx::mulmod() performs. Conversion to and from the canonical
+// form happens only when loading from or storing to bytes.
+//
+// Two multiplication kernels are provided. The 4x64-bit one needs a
+// 64x64->128 bit multiply, which wasm32 does not have and emulates with
+// several i64 multiplications per word product. The 8x32-bit one only uses
+// native 32x32->64 bit products and is selected for wasm builds. Both use
+// R = 2^256, so the representation does not depend on the kernel.
+
+#ifndef SEVERANCE_FIELD_LIMB_BITS
+#if defined(__wasm__)
+#define SEVERANCE_FIELD_LIMB_BITS 32
+#else
+#define SEVERANCE_FIELD_LIMB_BITS 64
+#endif
+#endif
+
+// With SEVERANCE_PROFILE, run time multiplications and inversions in Fr are
+// counted against the current verifier stage, see profile.hpp.
+#if defined(SEVERANCE_PROFILE)
+namespace profile {
+void
+count_field_mul();
+void
+count_field_inv();
+}
+#define SEVERANCE_FIELD_COUNT(P, op)                                           \
+    if constexpr (std::is_same<P, field::fr_params>::value) {                  \
+        if (!__builtin_is_constant_evaluated())                                \
+            profile::count_field_##op();                                       \
+    }
+#else
+#define SEVERANCE_FIELD_COUNT(P, op)
+#endif
+
+namespace field {
+
+using intx::uint256;
+using intx::uint512;
+using namespace intx::literals;
+
+// BN254 scalar field, the field of the circuit signals and of the PLONK
+// polynomial evaluations (q in constants.hpp).
+struct fr_params
+{
+    static constexpr uint256 modulus =
+      0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001_u256;
+    // -modulus^-1 mod 2^64
+    static constexpr uint64_t inv = 0xc2e1f593efffffff;
+    // R^2 mod modulus
+    static constexpr uint256 r2 =
+      0x0216d0b17f4e44a58c49833d53bb808553fe3ab1e35c59e31bb8e645ae216da7_u256;
+    // R mod modulus, the Montgomery form of 1
+    static constexpr uint256 one =
+      0x0e0a77c19a07df2f666ea36f7879462e36fc76959f60cd29ac96341c4ffffffb_u256;
+    // R^3 mod modulus, used to move an inverse back into Montgomery form
+    static constexpr uint256 r3 =
+      0x0cf8594b7fcc657c893cc664a19fcfed2a489cbe1cfbb6b85e94d8e1b4bf0040_u256;
+};
+
+// BN254 base field, the field of the G1 coordinates (qf in constants.hpp).
+struct fq_params
+{
+    static constexpr uint256 modulus =
+      0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_u256;
+    static constexpr uint64_t inv = 0x87d20782e4866389;
+    static constexpr uint256 r2 =
+      0x06d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89_u256;
+    static constexpr uint256 one =
+      0x0e0a77c19a07df2f666ea36f7879462c0a78eb28f5c70b3dd35d438dc58f0d9d_u256;
+    static constexpr uint256 r3 =
+      0x20fd6e902d592544ef7f0b0c0ada0afb62f210e6a7283db6b1cd6dafda1530df_u256;
+};
+
+namespace detail {
+
+// a + b * c + carry, returning the low word and leaving the high word in
+// carry.
+inline constexpr uint64_t
+mac(uint64_t a, uint64_t b, uint64_t c, uint64_t& carry)
+{
+#if INTX_HAS_BUILTIN_INT128
+    const auto t = intx::builtin_uint128{ b } * c + a + carry;
+    carry = uint64_t(t >> 64);
+    return uint64_t(t);
+#else
+    const auto t = intx::umul(b, c) + a + carry;
+    carry = t[1];
+    return t[0];
+#endif
+}
+
+inline constexpr uint32_t
+mac32(uint32_t a, uint32_t b, uint32_t c, uint32_t& carry)
+{
+    const uint64_t t = uint64_t{ b } * c + a + carry;
+    carry = uint32_t(t >> 32);
+    return uint32_t(t);
+}
+
+// Returns x - p if x >= p, x otherwise.
+template<typename P>
+inline constexpr uint256
+reduce_once(const uint256& x)
+{
+    const auto d = intx::subc(x, P::modulus);
+    return d.carry ? x : d.value;
+}
+
+// Montgomery product a * b * R^-1 mod p with CIOS word interleaving.
+//
+// The top word of both BN254 moduli is below 2^62, so the running sum
+// always fits in four words and the final carry word of the textbook
+// algorithm can be dropped. The result is fully reduced for a < p and
+// any b < 2^256.
+template<typename P>
+inline constexpr uint256
+mont_mul_64(const uint256& a, const uint256& b)
+{
+    const auto& p = P::modulus;
+    uint256 t;
+
+    for (int i = 0; i < 4; ++i) {
+        uint64_t A = 0;
+        t[0] = mac(t[0], a[0], b[i], A);
+        const uint64_t m = t[0] * P::inv;
+        uint64_t C = 0;
+        mac(t[0], m, p[0], C);
+        for (int j = 1; j < 4; ++j) {
+            t[j] = mac(t[j], a[j], b[i], A);
+            t[j - 1] = mac(t[j], m, p[j], C);
+        }
+        t[3] = C + A;
+    }
+
+    return reduce_once<P>(t);
+}
+
+// The same product on 8x32-bit words. -p^-1 mod 2^32 is the low word of
+// -p^-1 mod 2^64, and the top 32-bit word of p is below 2^30, so the
+// final carry word can be dropped here as well.
+template<typename P>
+inline constexpr uint256
+mont_mul_32(const uint256& a, const uint256& b)
+{
+    uint32_t x[8]{}, y[8]{}, p[8]{}, t[8]{};
+    for (int i = 0; i < 4; ++i) {
+        x[2 * i] = uint32_t(a[i]);
+        x[2 * i + 1] = uint32_t(a[i] >> 32);
+        y[2 * i] = uint32_t(b[i]);
+        y[2 * i + 1] = uint32_t(b[i] >> 32);
+        p[2 * i] = uint32_t(P::modulus[i]);
+        p[2 * i + 1] = uint32_t(P::modulus[i] >> 32);
+    }
+    const uint32_t inv = uint32_t(P::inv);
+
+    for (int i = 0; i < 8; ++i) {
+        uint32_t A = 0;
+        t[0] = mac32(t[0], x[0], y[i], A);
+        const uint32_t m = t[0] * inv;
+        uint32_t C = 0;
+        mac32(t[0], m, p[0], C);
+        for (int j = 1; j < 8; ++j) {
+            t[j] = mac32(t[j], x[j], y[i], A);
+            t[j - 1] = mac32(t[j], m, p[j], C);
+        }
+        t[7] = C + A;
+    }
+
+    uint256 r;
+    for (int i = 0; i < 4; ++i)
+        r[i] = uint64_t{ t[2 * i] } | uint64_t{ t[2 * i + 1] } << 32;
+    return reduce_once<P>(r);
+}
+
+template<typename P>
+inline constexpr uint256
+mont_mul(const uint256& a, const uint256& b)
+{
+#if SEVERANCE_FIELD_LIMB_BITS == 32
+    return mont_mul_32<P>(a, b);
+#else
+    return mont_mul_64<P>(a, b);
+#endif
+}
+
+// Full 256x256->512 bit product, without any reduction.
+inline constexpr uint512
+wide_mul_64(const uint256& a, const uint256& b)
+{
+    uint512 r;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j)
+            r[i + j] = mac(r[i + j], a[j], b[i], carry);
+        r[i + 4] = carry;
+    }
+    return r;
+}
+
+inline constexpr uint512
+wide_mul_32(const uint256& a, const uint256& b)
+{
+    uint32_t x[8]{}, y[8]{}, t[16]{};
+    for (int i = 0; i < 4; ++i) {
+        x[2 * i] = uint32_t(a[i]);
+        x[2 * i + 1] = uint32_t(a[i] >> 32);
+        y[2 * i] = uint32_t(b[i]);
+        y[2 * i + 1] = uint32_t(b[i] >> 32);
+    }
+    for (int i = 0; i < 8; ++i) {
+        uint32_t carry = 0;
+        for (int j = 0; j < 8; ++j)
+            t[i + j] = mac32(t[i + j], x[j], y[i], carry);
+        t[i + 8] = carry;
+    }
+
+    uint512 r;
+    for (int i = 0; i < 8; ++i)
+        r[i] = uint64_t{ t[2 * i] } | uint64_t{ t[2 * i + 1] } << 32;
+    return r;
+}
+
+// Montgomery reduction T * R^-1 mod p of a 512-bit T < p * R.
+template<typename P>
+inline constexpr uint256
+mont_reduce_64(const uint512& x)
+{
+    const auto& p = P::modulus;
+    uint512 t = x;
+    uint64_t pending = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        const uint64_t m = t[i] * P::inv;
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j)
+            t[i + j] = mac(t[i + j], m, p[j], carry);
+        // Carry out of t[i + 4] is added to t[i + 5] on the next round.
+        t[i + 4] = mac(t[i + 4], pending, 1, carry);
+        pending = carry;
+    }
+
+    return reduce_once<P>(uint256{ t[4], t[5], t[6], t[7] });
+}
+
+template<typename P>
+inline constexpr uint256
+mont_reduce_32(const uint512& x)
+{
+    uint32_t t[16]{}, p[8]{};
+    for (int i = 0; i < 8; ++i) {
+        t[2 * i] = uint32_t(x[i]);
+        t[2 * i + 1] = uint32_t(x[i] >> 32);
+    }
+    for (int i = 0; i < 4; ++i) {
+        p[2 * i] = uint32_t(P::modulus[i]);
+        p[2 * i + 1] = uint32_t(P::modulus[i] >> 32);
+    }
+    const uint32_t inv = uint32_t(P::inv);
+    uint32_t pending = 0;
+
+    for (int i = 0; i < 8; ++i) {
+        const uint32_t m = t[i] * inv;
+        uint32_t carry = 0;
+        for (int j = 0; j < 8; ++j)
+            t[i + j] = mac32(t[i + j], m, p[j], carry);
+        t[i + 8] = mac32(t[i + 8], pending, 1, carry);
+        pending = carry;
+    }
+
+    uint256 r;
+    for (int i = 0; i < 4; ++i)
+        r[i] = uint64_t{ t[2 * i + 8] } | uint64_t{ t[2 * i + 9] } << 32;
+    return reduce_once<P>(r);
+}
+
+inline constexpr uint512
+wide_mul(const uint256& a, const uint256& b)
+{
+#if SEVERANCE_FIELD_LIMB_BITS == 32
+    return wide_mul_32(a, b);
+#else
+    return wide_mul_64(a, b);
+#endif
+}
+
+template<typename P>
+inline constexpr uint256
+mont_reduce(const uint512& x)
+{
+#if SEVERANCE_FIELD_LIMB_BITS == 32
+    return mont_reduce_32<P>(x);
+#else
+    return mont_reduce_64<P>(x);
+#endif
+}
+
+inline constexpr uint256
+shr1(const uint256& x)
+{
+    return { x[0] >> 1 | x[1] << 63,
+             x[1] >> 1 | x[2] << 63,
+             x[2] >> 1 | x[3] << 63,
+             x[3] >> 1 };
+}
+
+// x / 2 mod p for x < p.
+template<typename P>
+inline constexpr uint256
+half(const uint256& x)
+{
+    // p is odd and below 2^255, so x + p is even and does not overflow.
+    return shr1((x[0] & 1) ? x + P::modulus : x);
+}
+
+// x^-1 mod p for 0 < x < p, by the binary extended Euclidean algorithm.
+//
+// Only shifts, additions and subtractions of 256-bit words are needed, no
+// multiplications or divisions. The running time depends on x, which is
+// fine as everything the contract inverts is public.
+template<typename P>
+inline constexpr uint256
+binary_inverse(const uint256& x)
+{
+    uint256 u = x;
+    uint256 v = P::modulus;
+    uint256 x1 = 1;
+    uint256 x2 = 0;
+
+    while (u != 1 && v != 1) {
+        while ((u[0] & 1) == 0) {
+            u = shr1(u);
+            x1 = half<P>(x1);
+        }
+        while ((v[0] & 1) == 0) {
+            v = shr1(v);
+            x2 = half<P>(x2);
+        }
+        if (u >= v) {
+            u -= v;
+            x1 = x1 >= x2 ? x1 - x2 : x1 + (P::modulus - x2);
+        } else {
+            v -= u;
+            x2 = x2 >= x1 ? x2 - x1 : x2 + (P::modulus - x1);
+        }
+    }
+
+    return u == 1 ? x1 : x2;
+}
+
+} // namespace detail
+
+template<typename P>
+class fp
+{
+  public:
+    using params = P;
+
+    constexpr fp() = default;
+
+    // Converts a canonical integer. Any x < 2^256 is accepted and reduced.
+    static constexpr fp from_uint256(const uint256& x)
+    {
+        // r2 must be the first operand, see mont_mul().
+        return from_montgomery(detail::mont_mul<P>(P::r2, x));
+    }
+
+    // Wraps a value that is already in Montgomery form.
+    static constexpr fp from_montgomery(const uint256& x)
+    {
+        fp r;
+        r.v = x;
+        return r;
+    }
+
+    static constexpr fp zero() { return fp(); }
+    static constexpr fp one() { return from_montgomery(P::one); }
+
+    static fp load(const uint8_t* src)
+    {
+        return from_uint256(intx::be::unsafe::load<uint256>(src));
+    }
+
+    void store(uint8_t* dst) const
+    {
+        intx::be::unsafe::store(dst, to_uint256());
+    }
+
+    constexpr uint256 to_uint256() const
+    {
+        return detail::mont_mul<P>(v, uint256{ 1 });
+    }
+
+    constexpr const uint256& montgomery() const { return v; }
+
+    constexpr bool is_zero() const { return v == 0; }
+
+    constexpr fp square() const { return *this * *this; }
+
+    // Multiplicative inverse, zero for zero.
+    constexpr fp inv() const
+    {
+        SEVERANCE_FIELD_COUNT(P, inv)
+        if (v == 0)
+            return fp();
+        // The binary inverse of x * R is x^-1 * R^-1. Two more factors of R
+        // come from a Montgomery product with R^3.
+        return from_montgomery(
+          detail::mont_mul<P>(detail::binary_inverse<P>(v), P::r3));
+    }
+
+    constexpr fp pow(const uint256& e) const
+    {
+        fp r = one();
+        for (int i = 255; i >= 0; --i) {
+            r = r.square();
+            if ((e[i / 64] >> (i % 64)) & 1)
+                r *= *this;
+        }
+        return r;
+    }
+
+    // Square root for p = 3 mod 4, r = a^((p + 1) / 4). Fails if a is not a
+    // square; either root may be returned.
+    constexpr bool sqrt(fp& r) const
+    {
+        static_assert((P::modulus[0] & 3) == 3, "sqrt needs p = 3 mod 4");
+        r = pow((P::modulus >> 2) + 1);
+        return r.square() == *this;
+    }
+
+    friend constexpr fp operator+(const fp& a, const fp& b)
+    {
+        // Both operands are below p < 2^254, the sum cannot overflow.
+        return from_montgomery(detail::reduce_once<P>(a.v + b.v));
+    }
+
+    friend constexpr fp operator-(const fp& a, const fp& b)
+    {
+        const auto d = intx::subc(a.v, b.v);
+        return from_montgomery(d.carry ? d.value + P::modulus : d.value);
+    }
+
+    friend constexpr fp operator*(const fp& a, const fp& b)
+    {
+        SEVERANCE_FIELD_COUNT(P, mul)
+        return from_montgomery(detail::mont_mul<P>(a.v, b.v));
+    }
+
+    constexpr fp operator-() const
+    {
+        return from_montgomery(v == 0 ? v : P::modulus - v);
+    }
+
+    constexpr fp& operator+=(const fp& b) { return *this = *this + b; }
+    constexpr fp& operator-=(const fp& b) { return *this = *this - b; }
+    constexpr fp& operator*=(const fp& b) { return *this = *this * b; }
+
+    friend constexpr bool operator==(const fp& a, const fp& b)
+    {
+        return a.v == b.v;
+    }
+
+    friend constexpr bool operator!=(const fp& a, const fp& b)
+    {
+        return a.v != b.v;
+    }
+
+  private:
+    uint256 v;
+};
+
+// Sum of products with a single Montgomery reduction at the end.
+//
+// Products of two Montgomery values are x * y * R^2, and a plain value x * R
+// shifted up by 256 bits is x * R^2 as well, so both are summed unreduced as
+// 512-bit integers. The sum is kept below p * R by subtracting p from its
+// upper half whenever that half reaches p, which makes reduce() a single
+// Montgomery reduction back to x * R.
+template<typename P>
+class accumulator
+{
+  public:
+    using value_type = fp<P>;
+
+    constexpr accumulator() = default;
+
+    // sum += a * b
+    constexpr accumulator& mac(const value_type& a, const value_type& b)
+    {
+        SEVERANCE_FIELD_COUNT(P, mul)
+        return add_wide(
+          detail::wide_mul(a.montgomery(), b.montgomery()));
+    }
+
+    // sum += a
+    constexpr accumulator& add(const value_type& a)
+    {
+        const auto& x = a.montgomery();
+        return add_wide(uint512{ 0, 0, 0, 0, x[0], x[1], x[2], x[3] });
+    }
+
+    constexpr value_type reduce() const
+    {
+        return value_type::from_montgomery(detail::mont_reduce<P>(sum));
+    }
+
+  private:
+    constexpr accumulator& add_wide(const uint512& x)
+    {
+        // sum < p * R and x < p * R, so this cannot overflow 512 bits.
+        sum += x;
+        const uint256 high{ sum[4], sum[5], sum[6], sum[7] };
+        if (high >= P::modulus) {
+            const uint256 h = high - P::modulus;
+            sum[4] = h[0];
+            sum[5] = h[1];
+            sum[6] = h[2];
+            sum[7] = h[3];
+        }
+        return *this;
+    }
+
+    uint512 sum;
+};
+
+// a[0] * b[0] + ... + a[count - 1] * b[count - 1]
+template<typename F>
+constexpr F
+dot(const F* a, const F* b, std::size_t count)
+{
+    accumulator<typename F::params> acc;
+    for (std::size_t i = 0; i < count; ++i)
+        acc.mac(a[i], b[i]);
+    return acc.reduce();
+}
+
+// Inverts count elements in place with a single field inversion
+// (Montgomery's trick): three multiplications per element plus one inv().
+// scratch must have room for count elements. Returns false and leaves
+// values untouched if any element is zero.
+template<typename F>
+bool
+batch_inverse(F* values, std::size_t count, F* scratch)
+{
+    if (count == 0)
+        return true;
+
+    // scratch[i] = values[0] * ... * values[i]
+    F acc = values[0];
+    scratch[0] = acc;
+    for (std::size_t i = 1; i < count; ++i) {
+        acc *= values[i];
+        scratch[i] = acc;
+    }
+    if (acc.is_zero())
+        return false;
+
+    F inv = acc.inv();
+    for (std::size_t i = count - 1; i > 0; --i) {
+        const F v = values[i];
+        values[i] = inv * scratch[i - 1];
+        inv *= v;
+    }
+    values[0] = inv;
+
+    return true;
+}
+
+template<typename F>
+bool
+batch_inverse(std::vector<F>& values)
+{
+    std::vector<F> scratch(values.size());
+    return batch_inverse(values.data(), values.size(), scratch.data());
+}
+
+} // namespace field
+
+using Fr = field::fp<field::fr_params>;
+using Fq = field::fp<field::fq_params>;
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <verifier.hpp>
+
+// A snarkjs Groth16 proof of the withdraw circuit as it is laid out in the
+// action data: A and C as x then y, B with the imaginary parts first, as
+// the alt_bn128 host functions take G2 points.
+struct groth16_proof
+{
+    std::array<char, 64> A;
+    std::array<char, 128> B;
+    std::array<char, 64> C;
+};
+
+static_assert(sizeof(groth16_proof) == 2 * 64 + 128, "padded proof");
+
+// Whether A and C are on the curve and the coordinates of B are below q,
+// checks that cost no host call.
+bool
+isWellFormedGroth16Proof(const groth16_proof& proof);
+
+// One G1 multiplication per public input and a single pairing call, but
+// the key comes from a trusted setup of its own. Fails on public inputs
+// that are not below q.
+bool
+isValidGroth16Proof(const groth16_proof& proof,
+                    const withdraw_inputs& public_inputs);
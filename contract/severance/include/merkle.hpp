@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <constants.hpp>
+#include <field.hpp>
+#include <mimcsponge.hpp>
+
+// level_defaults in the field, converted by the compiler.
+inline constexpr std::array<Fr, 32> level_defaults_fr = [] {
+    std::array<Fr, 32> r{};
+    for (int i = 0; i < 32; ++i) {
+        r[i] = Fr::from_uint256(level_defaults[i]);
+    }
+    return r;
+}();
+
+// Inserts leaf at index into the incremental Merkle tree and returns the new
+// root. Every level of the path is hashed under the leaf as key.
+//
+// The node storage is left to the caller: last_level_hash(level) returns
+// the left sibling stored for a level and set_last_level_hash(level, hash)
+// records the node on the path, so the same code runs over the contract
+// tables and in the native build.
+template<typename Load, typename Store>
+Fr
+merkle_insert(const Fr& leaf,
+              uint32_t index,
+              Load&& last_level_hash,
+              Store&& set_last_level_hash)
+{
+    const MiMC5Sponge::keyed_sponge mimc(leaf);
+
+    Fr left, right;
+    Fr current_hash = leaf;
+
+    for (int i = 0; i < MERKLE_HEIGHT; i++) {
+
+        if (index % 2 == 0) {
+            left = current_hash;
+            right = level_defaults_fr[i];
+        } else {
+            left = last_level_hash(i);
+            right = current_hash;
+        }
+
+        set_last_level_hash(i, current_hash);
+
+        current_hash = mimc.hash(left, right);
+        index /= 2;
+    }
+
+    return current_hash;
+}
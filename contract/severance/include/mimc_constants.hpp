@@ -0,0 +1,1127 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <field.hpp>
+
+namespace MiMC5Sponge {
+
+// circomlib MiMCFeistel round constants. Round i of an n round permutation
+// adds c[i - 1]; the first and the last round add no constant.
+//
+// The values are stored in Montgomery form as four little-endian words,
+// with the circomlib decimal value above each one.
+inline constexpr Fr round_constants[] = {
+    // 7120861356467848435263064379192047478074060781135320967663101236819528304084
+    Fr::from_montgomery({ 0x965ac8dfe4478c84,
+                          0xe7bdd790e2e696e0,
+                          0xe5836bff1f4ee44a,
+                          0x053e27bc8307157c }),
+    // 5024705281721889198577876690145313457398658950011302225525409148828000436681
+    Fr::from_montgomery({ 0x4876b92b82ed2b58,
+                          0x79d381c02f25e76a,
+                          0xcc300398b121b06b,
+                          0x2bca90bb9ac89253 }),
+    // 17980351014018068290387269214713820287804403312720763401943303895585469787384
+    Fr::from_montgomery({ 0x5c96ba766407c309,
+                          0x57818b6ba200a9a8,
+                          0xf5072b6600a8566e,
+                          0x0cb30314d7437db9 }),
+    // 19886576439381707240399940949310933992335779767309383709787331470398675714258
+    Fr::from_montgomery({ 0x4c0a0b8900fbbfca,
+                          0x854f39e1204d124a,
+                          0xadf3ae348f3965af,
+                          0x2d623578b4d7a6e7 }),
+    // 1213715278223786725806155661738676903520350859678319590331207960381534602599
+    Fr::from_montgomery({ 0x52a3efe1384869b6,
+                          0x15f5474e5fce1dc3,
+                          0x3f71f5013b43c6f8,
+                          0x08031df14eb93355 }),
+    // 18162138253399958831050545255414688239130588254891200470934232514682584734511
+    Fr::from_montgomery({ 0xe596d42b748f4b03,
+                          0x1afacc6e17400383,
+                          0x842a60b81616647d,
+                          0x1e9dce3fb4aff03f }),
+    // 7667462281466170157858259197976388676420847047604921256361474169980037581876
+    Fr::from_montgomery({ 0x2293d1cc03a4271b,
+                          0xac8be24e461c924e,
+                          0x531112d29e92bfb4,
+                          0x11fa45b080f45d7f }),
+    // 7207551498477838452286210989212982851118089401128156132319807392460388436957
+    Fr::from_montgomery({ 0xf56c490b5e0a0c7d,
+                          0x3fbd62afd8a3638c,
+                          0x2617403f6e1d83ef,
+                          0x2aa1e0af756a2c7f }),
+    // 9864183311657946807255900203841777810810224615118629957816193727554621093838
+    Fr::from_montgomery({ 0x8723029776002c94,
+                          0xb20cd5e488987498,
+                          0xf6d59d2187f997c7,
+                          0x29f9c30db4efe9ae }),
+    // 4798196928559910300796064665904583125427459076060519468052008159779219347957
+    Fr::from_montgomery({ 0xb14832f519ecea5d,
+                          0xbbac626fd00f1b1a,
+                          0xa077ecd514273720,
+                          0x089e5ed5f00e9416 }),
+    // 17387238494588145257484818061490088963673275521250153686214197573695921400950
+    Fr::from_montgomery({ 0x045832a1025b44c4,
+                          0x063d96e0489f0aac,
+                          0xd1fd0ae1242eb7a0,
+                          0x2061b9d590051271 }),
+    // 10005334761930299057035055370088813230849810566234116771751925093634136574742
+    Fr::from_montgomery({ 0x29071ea9c68ef1f5,
+                          0x56de42f6cf5417e9,
+                          0x28a1ae776ec646ef,
+                          0x22c7e244015e5d82 }),
+    // 11897542014760736209670863723231849628230383119798486487899539017466261308762
+    Fr::from_montgomery({ 0x5c4a7b221511a59a,
+                          0xd5f0d5a8e3229e1a,
+                          0xff4fbf78f2426a10,
+                          0x28752f24383e6552 }),
+    // 16771780563523793011283273687253985566177232886900511371656074413362142152543
+    Fr::from_montgomery({ 0xb22f2a57a75e9555,
+                          0x2e14bca8cb21aadb,
+                          0x57dc9e9831b62d5c,
+                          0x2d7b7158676de0fa }),
+    // 749264854018824809464168489785113337925400687349357088413132714480582918506
+    Fr::from_montgomery({ 0xeedcae02ae854861,
+                          0xd6c1e1785a8ff80a,
+                          0x3ca6da94567baa9f,
+                          0x2fbec01b89d5ee67 }),
+    // 3683645737503705042628598550438395339383572464204988015434959428676652575331
+    Fr::from_montgomery({ 0x80be56cdb814b528,
+                          0x3785e6f9dd05fa41,
+                          0x9bba5f86541809bc,
+                          0x24340a824e789429 }),
+    // 7556750851783822914673316211129907782679509728346361368978891584375551186255
+    Fr::from_montgomery({ 0xc327f547a8427908,
+                          0x6e0d542694f1b502,
+                          0xb151b673f84f96f6,
+                          0x20a9f2b2bf65be63 }),
+    // 20391289379084797414557439284689954098721219201171527383291525676334308303023
+    Fr::from_montgomery({ 0xf4c2a91e2679704a,
+                          0x1d1941e4180ae43e,
+                          0xfda101936747cc5a,
+                          0x0dd093f02f8f821e }),
+    // 18146517657445423462330854383025300323335289319277199154920964274562014376193
+    Fr::from_montgomery({ 0x4b5143419be0289d,
+                          0x02169bcdcdbbcfcc,
+                          0x65fe470e903d8275,
+                          0x2d368b95313a7bf4 }),
+    // 8080173465267536232534446836148661251987053305394647905212781979099916615292
+    Fr::from_montgomery({ 0xda018b4d5f294da1,
+                          0x3834c08940cd98b2,
+                          0x882f2cf20ce323c8,
+                          0x1a3ae77b146542ad }),
+    // 10796443006899450245502071131975731672911747129805343722228413358507805531141
+    Fr::from_montgomery({ 0x3c5c7db30350fdb0,
+                          0xae44560dde117156,
+                          0xa8b4e9554d1979fd,
+                          0x1da2e000b10f5c0b }),
+    // 5404287610364961067658660283245291234008692303120470305032076412056764726509
+    Fr::from_montgomery({ 0x1140045666557769,
+                          0xfceb58b54e582536,
+                          0x59e33095713a6660,
+                          0x0b4163475b224665 }),
+    // 4623894483395123520243967718315330178025957095502546813929290333264120223168
+    Fr::from_montgomery({ 0x134c91ac2a2b60ea,
+                          0xb36ad58790339df8,
+                          0x3a38553656461cd4,
+                          0x07765f0779596038 }),
+    // 16845753148201777192406958674202574751725237939980634861948953189320362207797
+    Fr::from_montgomery({ 0x3a4d673d21500e40,
+                          0xbad08a00efe5936d,
+                          0x35ea545f25929e02,
+                          0x0c0b55d60d4dbaf2 }),
+    // 4622170486584704769521001011395820886029808520586507873417553166762370293671
+    Fr::from_montgomery({ 0x7cc1039c87daacd8,
+                          0x9aad78db4da396e7,
+                          0xfab4b66e82c2e356,
+                          0x097d79018c1dc36c }),
+    // 16688277490485052681847773549197928630624828392248424077804829676011512392564
+    Fr::from_montgomery({ 0xdaaf2e07106c5eba,
+                          0xfa6eced924162a83,
+                          0xb866ae62753baac5,
+                          0x14d8b9a7a723600d }),
+    // 11878652861183667748838188993669912629573713271883125458838494308957689090959
+    Fr::from_montgomery({ 0x4b970eccfbc9994a,
+                          0x3cf6b1dc25dac455,
+                          0xbe833a289f9d50ca,
+                          0x087afa054632beae }),
+    // 2436445725746972287496138382764643208791713986676129260589667864467010129482
+    Fr::from_montgomery({ 0xf842bdb35cfc73f5,
+                          0x2aa38d9132159818,
+                          0xd1cdf97d8010a782,
+                          0x19ec5304410e782f }),
+    // 1888098689545151571063267806606510032698677328923740058080630641742325067877
+    Fr::from_montgomery({ 0xb7dcbcf64c951cdf,
+                          0xdbaa8d91c864817c,
+                          0x563203021e01c030,
+                          0x23ab6efb6432d128 }),
+    // 148924106504065664829055598316821983869409581623245780505601526786791681102
+    Fr::from_montgomery({ 0x803cea82aa292fd5,
+                          0x59b7ba69a8fa72dd,
+                          0x227ca712999409e9,
+                          0x0a3b013912357908 }),
+    // 18875020877782404439294079398043479420415331640996249745272087358069018086569
+    Fr::from_montgomery({ 0xa2979d9ab88105c3,
+                          0xd4a491a37735272f,
+                          0x48e52b99882aafdb,
+                          0x0e6c446393f50d50 }),
+    // 15189693413320228845990326214136820307649565437237093707846682797649429515840
+    Fr::from_montgomery({ 0x296fb4af362f209d,
+                          0x3d7440ae34b220ea,
+                          0x1348f92cd1d36ec5,
+                          0x18e31c18c7dc4ebb }),
+    // 19669450123472657781282985229369348220906547335081730205028099210442632534079
+    Fr::from_montgomery({ 0xa854e759da6bc6fe,
+                          0x9ecc3f286a5e47d1,
+                          0x91f315c99f7e1d63,
+                          0x0093487853f27b55 }),
+    // 5521922218264623411380547905210139511350706092570900075727555783240701821773
+    Fr::from_montgomery({ 0xcf6577c4263a3053,
+                          0x07ba4e8b19a96773,
+                          0x4823c3464f2b95b4,
+                          0x037283079a4920e9 }),
+    // 4144769320246558352780591737261172907511489963810975650573703217887429086546
+    Fr::from_montgomery({ 0xfca2bc05838f65ef,
+                          0xd0619b81a0098db2,
+                          0x9affa45f9b116cba,
+                          0x2ff7c783621b2687 }),
+    // 10097732913112662248360143041019433907849917041759137293018029019134392559350
+    Fr::from_montgomery({ 0x8dcd278b2ef1f67d,
+                          0xb660e8138aa1a76e,
+                          0x92da646542f28754,
+                          0x2e893c2cc0d6fbd9 }),
+    // 1720059427972723034107765345743336447947522473310069975142483982753181038321
+    Fr::from_montgomery({ 0xfac9d4bc65135608,
+                          0xcab8ab571688c95c,
+                          0x46edcf83ca7b2739,
+                          0x04975241dd60a06e }),
+    // 6302388219880227251325608388535181451187131054211388356563634768253301290116
+    Fr::from_montgomery({ 0x4f9cc3689758ce77,
+                          0xbf40ba1ef4f2752a,
+                          0x334f6511a048a834,
+                          0x0f44eb3f2d028fa9 }),
+    // 6745410632962119604799318394592010194450845483518862700079921360015766217097
+    Fr::from_montgomery({ 0xfc2649fd978e5335,
+                          0x252b60b6a09be9fb,
+                          0x1ac04606d0487b92,
+                          0x032ad97ced0a6e75 }),
+    // 10858157235265583624235850660462324469799552996870780238992046963007491306222
+    Fr::from_montgomery({ 0xafa36ebd1c897e85,
+                          0x852a22648bb90e25,
+                          0x3a54294d35ce42ba,
+                          0x21142e942e1eb278 }),
+    // 20241898894740093733047052816576694435372877719072347814065227797906130857593
+    Fr::from_montgomery({ 0x635397d7337fe4db,
+                          0xb6335ade5887923f,
+                          0xc90be62508ff245f,
+                          0x0f7635528879fc0a }),
+    // 10165780782761211520836029617746977303303335603838343292431760011576528327409
+    Fr::from_montgomery({ 0x8a4ee2bc272c4012,
+                          0xc3f75874e5dc3485,
+                          0xa1093ec624e15279,
+                          0x0c04ffd0285073c9 }),
+    // 2832093654883670345969792724123161241696170611611744759675180839473215203706
+    Fr::from_montgomery({ 0x8984e522c1a693f4,
+                          0xc97e33f366920a81,
+                          0x591d28bd67f1c562,
+                          0x123cfa121ad57eee }),
+    // 153011722355526826233082383360057587249818749719433916258246100068258954737
+    Fr::from_montgomery({ 0xe8d9fd32586c82f0,
+                          0xfe595ae132924064,
+                          0x300ca429b3599fdf,
+                          0x0c662f964f420fc7 }),
+    // 20196970640587451358539129330170636295243141659030208529338914906436009086943
+    Fr::from_montgomery({ 0x5664de04f84bc182,
+                          0xdc24042292dd0e90,
+                          0x05a62d49c72ba72e,
+                          0x0c3a5c23cb6f75ec }),
+    // 3180973917010545328313139835982464870638521890385603025657430208141494469656
+    Fr::from_montgomery({ 0x03f2c54d846768ae,
+                          0x2edf896d51ca3ed0,
+                          0x2f745dccd7afd403,
+                          0x0e6146337488141e }),
+    // 17198004293191777441573635123110935015228014028618868252989374962722329283022
+    Fr::from_montgomery({ 0x0ba164bb345bc7c2,
+                          0x8c79554da106cb5b,
+                          0x35e49b1925748ad6,
+                          0x0d1bde49c9a6863f }),
+    // 7642160509228669138628515458941659189680509753651629476399516332224325757132
+    Fr::from_montgomery({ 0xdb55ced527c17d93,
+                          0x88af9dda8ee41e32,
+                          0x603c6cd2d59c3912,
+                          0x25e84dda05697ffd }),
+    // 19346204940546791021518535594447257347218878114049998691060016493806845179755
+    Fr::from_montgomery({ 0x231118161e1d4d4a,
+                          0x9773984a9a111ead,
+                          0x05a6c6d0a510a26e,
+                          0x033b471ebcfff0d4 }),
+    // 11501810868606870391127866188394535330696206817602260610801897042898616817272
+    Fr::from_montgomery({ 0xe92133668689c7f6,
+                          0xf87356ac6496843b,
+                          0x61b86350d02544a8,
+                          0x169964a2a16408c1 }),
+    // 3113973447392053821824427670386252797811804954746053461397972968381571297505
+    Fr::from_montgomery({ 0x11ce96e685dd1b89,
+                          0x54f5de58635256d2,
+                          0x26ea687dbee2ddfb,
+                          0x2013a52d36d1aae3 }),
+    // 6545064306297957002139416752334741502722251869537551068239642131448768236585
+    Fr::from_montgomery({ 0x15d840daf9c86d1f,
+                          0x57ddddcfc8ff5f73,
+                          0x8dd492e5eb1ea9c1,
+                          0x2bbe5d10f1532baf }),
+    // 5203908808704813498389265425172875593837960384349653691918590736979872578408
+    Fr::from_montgomery({ 0x35f0e1ad79e10572,
+                          0xbe1755f568adee3b,
+                          0x0157b196fc2ec608,
+                          0x186ce41133fc24da }),
+    // 2246692432011290582160062129070762007374502637007107318105405626910313810224
+    Fr::from_montgomery({ 0x50d1a9cf5b729c20,
+                          0xde5696a5766fd33a,
+                          0xf08e23500223779a,
+                          0x27db82878e82ebf6 }),
+    // 11760570435432189127645691249600821064883781677693087773459065574359292849137
+    Fr::from_montgomery({ 0x566ccee4791d4761,
+                          0x9008d506a956e7bf,
+                          0x01aa85feb33a475e,
+                          0x1bf13e3c5f70afef }),
+    // 5543749482491340532547407723464609328207990784853381797689466144924198391839
+    Fr::from_montgomery({ 0xc153064bf5b6e178,
+                          0xd7b866101a25d002,
+                          0xf5e7df197663ce96,
+                          0x0be4a53e02142c80 }),
+    // 8837549193990558762776520822018694066937602576881497343584903902880277769302
+    Fr::from_montgomery({ 0x134870470b5fd92d,
+                          0x0b63ed4a81fab24e,
+                          0x0af27135a920940e,
+                          0x02eaaf8e54934498 }),
+    // 12855514863299373699594410385788943772765811961581749194183533625311486462501
+    Fr::from_montgomery({ 0xeefe5909b3381026,
+                          0x948ea6285586cbde,
+                          0x9554c5b7178af828,
+                          0x0de02b168c691288 }),
+    // 5363660674689121676875069134269386492382220935599781121306637800261912519729
+    Fr::from_montgomery({ 0x7c3d55c57f6327a0,
+                          0x4f72f0e631823cb9,
+                          0x5988b17440ebc729,
+                          0x2421d938a61e9196 }),
+    // 13162342403579303950549728848130828093497701266240457479693991108217307949435
+    Fr::from_montgomery({ 0x403469f8a6fd3ddf,
+                          0x31da7ecc0f1e2fc6,
+                          0x1f54d2151d8b7b83,
+                          0x2fff43a74dca24a4 }),
+    // 916941639326869583414469202910306428966657806899788970948781207501251816730
+    Fr::from_montgomery({ 0x159ab2d4410f19cb,
+                          0xfe487d3ff9907082,
+                          0x24d3bedc57c126bb,
+                          0x0d31c0dba8f41b21 }),
+    // 15618589556584434434009868216186115416835494805174158488636000580759692174228
+    Fr::from_montgomery({ 0xc29dd5715e23769b,
+                          0x01f236c5148867b7,
+                          0x3e8991188f983b56,
+                          0x26b31489bf46d403 }),
+    // 8959562060028569701043973060670353733575345393653685776974948916988033453971
+    Fr::from_montgomery({ 0x66bc1225d55a8cc4,
+                          0xc5c12da31ae40831,
+                          0x99d6ba5388bb1450,
+                          0x28b3a22d29ce4cd1 }),
+    // 16390754464333401712265575949874369157699293840516802426621216808905079127650
+    Fr::from_montgomery({ 0x07cde9294f3ae136,
+                          0x379f27cb8f36963d,
+                          0x62c878f2f7516ab7,
+                          0x2d2b9a1a752da92c }),
+    // 168282396747788514908709091757591226095443902501365500003618183905496160435
+    Fr::from_montgomery({ 0x32ecbe123f9b6d04,
+                          0x949d2d5e7bb3d955,
+                          0x4dd35476518f56b1,
+                          0x24f766e5b6dcf24e }),
+    // 8327443473179334761744301768309008451162322941906921742120510244986704677004
+    Fr::from_montgomery({ 0x32173ad52e18ea89,
+                          0x2507c29852df6d2b,
+                          0xfe03d8ae0c3af434,
+                          0x04ce939ca6dc4db5 }),
+    // 17213012626801210615058753489149961717422101711567228037597150941152495100640
+    Fr::from_montgomery({ 0xd94dbc6851476822,
+                          0x970b3bddac44ba3b,
+                          0xc71d5b1c202fa397,
+                          0x13c04e7f19a60fca }),
+    // 10394369641533736715250242399198097296122982486516256408681925424076248952280
+    Fr::from_montgomery({ 0xac453aee12d54b48,
+                          0x9b252827f7df10f9,
+                          0xa2876d90eef132d6,
+                          0x2d3d2f7be77dea04 }),
+    // 17784386835392322654196171115293700800825771210400152504776806618892170162248
+    Fr::from_montgomery({ 0xc396ad85ffab8fcf,
+                          0xe08871c4d7d3812b,
+                          0x8a56fd270f0cafe6,
+                          0x05c1edda2145bf41 }),
+    // 16533189939837087893364000390641148516479148564190420358849587959161226782982
+    Fr::from_montgomery({ 0x12aa4dbf2f5c0380,
+                          0x266f1dc4aae3f163,
+                          0xedb111c8e98700dc,
+                          0x03f6b45ee32eabc8 }),
+    // 18725396114211370207078434315900726338547621160475533496863298091023511945076
+    Fr::from_montgomery({ 0x4d46b31d8549944d,
+                          0x31fb16f86a6db35f,
+                          0xefb760c86edf3d43,
+                          0x0ee73d6cc51f1d78 }),
+    // 7132325028834551397904855671244375895110341505383911719294705267624034122405
+    Fr::from_montgomery({ 0xefdc0e94221c950e,
+                          0x6193a5782d50a1bc,
+                          0xbda8b8fc3f299db4,
+                          0x12ba4aa01e5dc606 }),
+    // 148317947440800089795933930720822493695520852448386394775371401743494965187
+    Fr::from_montgomery({ 0xf9debb42d571eeca,
+                          0xd60b6f67683edfec,
+                          0xd2c3c7f6fbee6dde,
+                          0x05cc2ac369706023 }),
+    // 19001050671757720352890779127693793630251266879994702723636759889378387053056
+    Fr::from_montgomery({ 0xc6c7b00fb3500d96,
+                          0xf055b7309a578ed4,
+                          0xb14a5b8d90e97556,
+                          0x2d8291b2ea11c9ba }),
+    // 18824274411769830274877839365728651108434404855803844568234862945613766611460
+    Fr::from_montgomery({ 0xbab025965de2301f,
+                          0x793f5dd8169f5d7c,
+                          0xbe9f1385ee9c77a8,
+                          0x1bf90513ea3a2bae }),
+    // 12771414330193951156383998390424063470766226667986423961689712557338777174205
+    Fr::from_montgomery({ 0xb6c0010631cf9aaa,
+                          0xe904b3b31502783e,
+                          0xdc4d267f60ff72c9,
+                          0x0a15c551fc0d7070 }),
+    // 11332046574800279729678603488745295198038913503395629790213378101166488244657
+    Fr::from_montgomery({ 0x3f0ffb9425ef2810,
+                          0x836d664d66186db0,
+                          0xc4a86d6868da4c8d,
+                          0x01f8740ed80d145b }),
+    // 9607550223176946388146938069307456967842408600269548190739947540821716354749
+    Fr::from_montgomery({ 0x178429c6b9d0b9d7,
+                          0xf7244527e6c1ad22,
+                          0x7d5552eddaa3f9b9,
+                          0x136d69d0d4558f87 }),
+    // 8756385288462344550200229174435953103162307705310807828651304665320046782583
+    Fr::from_montgomery({ 0xa5cd57bdb83c3e6d,
+                          0xdb8d5ab08205276b,
+                          0xc0eafe1882eeb199,
+                          0x14a2853688ccbd47 }),
+    // 176061952957067086877570020242717222844908281373122372938833890096257042779
+    Fr::from_montgomery({ 0x4cb7de077fc324f5,
+                          0x8356d50345c6ee6d,
+                          0x460e20e63512806e,
+                          0x004cbce93d6eae95 }),
+    // 12200212977482648306758992405065921724409841940671166017620928947866825250857
+    Fr::from_montgomery({ 0x7561a8ba26355ad4,
+                          0x2d55d368ac8cebc2,
+                          0x96045af03af22d98,
+                          0x06c7055fde873005 }),
+    // 10868453624107875516866146499877130701929063632959660262366632833504750028858
+    Fr::from_montgomery({ 0x0b30030ad2b2efc0,
+                          0x15a66bca9724f89e,
+                          0xf597a67c2594eb96,
+                          0x202a08aca52cd969 }),
+    // 2016095394399807253596787752134573207202567875457560571095586743878953450738
+    Fr::from_montgomery({ 0x1e718096d7dd6fa8,
+                          0xdf44afae6e28c67b,
+                          0x9bf979c32b431c1e,
+                          0x2e372caf8bdea6a2 }),
+    // 21815578223768330433802113452339488275704145896544481092014911825656390567514
+    Fr::from_montgomery({ 0x0adb3c386d008487,
+                          0xb14812f77cebef82,
+                          0x576b5c5a21e3caf8,
+                          0x09bb96c836be9fcd }),
+    // 4923772847693564777744725640710197015181591950368494148029046443433103381621
+    Fr::from_montgomery({ 0xa484ecb9d89a8c85,
+                          0x798aab523f63ba2f,
+                          0x83b3525320849f9e,
+                          0x10bc7259d7e3b3c0 }),
+    // 1813584943682214789802230765734821149202472893379265320098816901270224589984
+    Fr::from_montgomery({ 0xff40d416a8550899,
+                          0xcc1a8852e6c44b6a,
+                          0x125e963508fb3488,
+                          0x133a8abe39871ae5 }),
+    // 10810123816265612772922113403831964815724109728287572256602010709288980656498
+    Fr::from_montgomery({ 0x8e78655c5afa4755,
+                          0xed853559f5ad1fa8,
+                          0x51ed7eaf10a596ec,
+                          0x2a8354d4f2484765 }),
+    // 1153669123397255702524721206511185557982017410156956216465120456256288427021
+    Fr::from_montgomery({ 0xfb2560e6d25dfcab,
+                          0xe947f9d95e99c71c,
+                          0x49a8c8c4afe309d9,
+                          0x25821745d38bc2d8 }),
+    // 5007518659266430200134478928344522649876467369278722765097865662497773767152
+    Fr::from_montgomery({ 0x5a7381b4c4c1e505,
+                          0xf144732eb0a2b6c2,
+                          0x3006468ed0061d5e,
+                          0x2397a6a2d491b47f }),
+    // 2511432546938591792036639990606464315121646668029252285288323664350666551637
+    Fr::from_montgomery({ 0x8228c1e5c125040f,
+                          0x51a2035048ae3c8d,
+                          0x57d68d1b8d48eff8,
+                          0x08e4aafcfd1ac6e8 }),
+    // 32883284540320451295484135704808083452381176816565850047310272290579727564
+    Fr::from_montgomery({ 0xc44a0a92d6c8796c,
+                          0x02abf64dac5b17d8,
+                          0x9515d7aa54e4fcb2,
+                          0x2bd7f2f7662dac75 }),
+    // 10484856914279112612610993418405543310546746652738541161791501150994088679557
+    Fr::from_montgomery({ 0x1850b627da5b0862,
+                          0x49d4a1eda8a5252f,
+                          0x7e3b6d3209922072,
+                          0x1a2af99312067570 }),
+    // 2026733759645519472558796412979210009170379159866522399881566309631434814953
+    Fr::from_montgomery({ 0xe833088ff5ccdd65,
+                          0xe8d295f19bc8184d,
+                          0x598c12f964a4ae5e,
+                          0x0376629199627b11 }),
+    // 14731806221235869882801331463708736361296174006732553130708107037190460654379
+    Fr::from_montgomery({ 0xf15f80932f811de8,
+                          0x32b721f7819071bf,
+                          0x1cb3b9a5a0ba1bd6,
+                          0x1784e3c3a6c0166a }),
+    // 14740327483193277147065845135561988641238516852487657117813536909482068950652
+    Fr::from_montgomery({ 0x24fe7555547fe1c7,
+                          0xcab6df2146a94ea2,
+                          0x963c55e0ab3fe282,
+                          0x2b019b8e9e77726d }),
+    // 18787428285295558781869865751953016580493190547148386433580291216673009884554
+    Fr::from_montgomery({ 0xd54b0874cc8d5b70,
+                          0xf811eda0448713a6,
+                          0xa0c19036c093131a,
+                          0x0e877352aaa642f5 }),
+    // 3804047064713122820157099453648459188816376755739202017447862327783289895072
+    Fr::from_montgomery({ 0xff24de37055dfb15,
+                          0x1fd250e7eed6b1d1,
+                          0x859f76915b7ae252,
+                          0x18c0f634c873acf9 }),
+    // 16709604795697901641948603019242067672006293290826991671766611326262532802914
+    Fr::from_montgomery({ 0xe833582be77026ff,
+                          0xf3a15eadf6ae4bc1,
+                          0x4d56669d4138810a,
+                          0x1ad2ebbb74d46aae }),
+    // 11061717085931490100602849654034280576915102867237101935487893025907907250695
+    Fr::from_montgomery({ 0x630597f7074671bc,
+                          0x43105d7219c3fb2a,
+                          0xe8ebb17156272caa,
+                          0x2d03beb1da522b8c }),
+    // 2821730726367472966906149684046356272806484545281639696873240305052362149654
+    Fr::from_montgomery({ 0xe9a33d869d970f38,
+                          0x1b95b65163384577,
+                          0x662f2dc188db2cf2,
+                          0x26d305fa1cb2e2ca }),
+    // 17467794879902895769410571945152708684493991588672014763135370927880883292655
+    Fr::from_montgomery({ 0x6acd92a2272a6dad,
+                          0x936e9a8318b52886,
+                          0x0df0af315cd2893e,
+                          0x096bb23032eac37b }),
+    // 1571520786233540988201616650622796363168031165456869481368085474420849243232
+    Fr::from_montgomery({ 0xfa2ebf50f7bcd276,
+                          0x21c556193791a91a,
+                          0xe933d52633765f81,
+                          0x2d933fc2140bd34d }),
+    // 10041051776251223165849354194892664881051125330236567356945669006147134614302
+    Fr::from_montgomery({ 0x4270ccaa6b288b66,
+                          0xcdb0c75aa7ddfef7,
+                          0x6a7a22ebc6950736,
+                          0x239e36992133e204 }),
+    // 3981753758468103976812813304477670033098707002886030847251581853700311567551
+    Fr::from_montgomery({ 0x1e6ffe9c1a7ffb84,
+                          0xb5ad685fc9349c41,
+                          0x3dd4aaf4a69a6c17,
+                          0x067763d04e338af9 }),
+    // 4365864398105436789177703571412645548020537580493599380018290523813331678900
+    Fr::from_montgomery({ 0x5e719f647690dc00,
+                          0x8e946f38b703f47c,
+                          0x83509339b84d7f27,
+                          0x26d785c6c58684fc }),
+    // 2391801327305361293476178683853802679507598622000359948432171562543560193350
+    Fr::from_montgomery({ 0x26f5d4a6c0027bc5,
+                          0x1da63dfbca8da331,
+                          0xea6dacec7cb2d1f3,
+                          0x27d16c08f2f8272d }),
+    // 214219368547551689972421167733597094823289857206402800635962137077096090722
+    Fr::from_montgomery({ 0xf935af775f8d01e0,
+                          0xefda940dc32b506f,
+                          0x3a8bad9683c4bb01,
+                          0x162bf90e4cbd605b }),
+    // 18192064100315141084242006659317257023098826945893371479835220462302399655674
+    Fr::from_montgomery({ 0x06f0613f159b659f,
+                          0x0147a1f18111317e,
+                          0x5b4490b596f4b388,
+                          0x2d716b61964c64d5 }),
+    // 15487549757142039139328911515400805508248576685795694919457041092150651939253
+    Fr::from_montgomery({ 0xcef44b03d28ade1e,
+                          0xd044a9206d768709,
+                          0xabb5e411501b7ce9,
+                          0x23426276f87e0d64 }),
+    // 10142447197759703415402259672441315777933858467700579946665223821199077641122
+    Fr::from_montgomery({ 0xe6feffe4bef70255,
+                          0x0b6331f42193df8f,
+                          0xc4e8146677925f60,
+                          0x0fe43649b6d5f7b8 }),
+    // 11246573086260753259993971254725613211193686683988426513880826148090811891866
+    Fr::from_montgomery({ 0x3ca6421e210c59f4,
+                          0x760dc776be6c5ec0,
+                          0x04fa4b5e4be56e77,
+                          0x1eb13c8d5fdca216 }),
+    // 6574066859860991369704567902211886840188702386542112593710271426704432301235
+    Fr::from_montgomery({ 0xbcc55591f14b3c90,
+                          0xa8c03a5a1b97c0f2,
+                          0xc0f89ba1bffc46f9,
+                          0x017e783383d1012b }),
+    // 11311085442652291634822798307831431035776248927202286895207125867542470350078
+    Fr::from_montgomery({ 0x215b76b852cf399c,
+                          0x9d61f74d08b6db75,
+                          0xec622b60fd19dd7a,
+                          0x06aee032420b4383 }),
+    // 20977948360215259915441258687649465618185769343138135384346964466965010873779
+    Fr::from_montgomery({ 0x481261174db110c2,
+                          0xb91d621b0f10180c,
+                          0x827948ad04ea16a0,
+                          0x2ea58066e2cf3772 }),
+    // 792781492853909872425531014397300057232399608769451037135936617996830018501
+    Fr::from_montgomery({ 0xec1e7f213b951fb6,
+                          0x6d61e6cd72d7b2bb,
+                          0x51b20a7d2dfb96ed,
+                          0x07ad415cb2925e13 }),
+    // 5027602491523497423798779154966735896562099398367163998686335127580757861872
+    Fr::from_montgomery({ 0xff6328b79decd43f,
+                          0x36a8a93edd267386,
+                          0x198120e848c12ec6,
+                          0x10baf3e22dd4c544 }),
+    // 14595204575654316237672764823862241845410365278802914304953002937313300553572
+    Fr::from_montgomery({ 0x699f8a886fdd07f1,
+                          0x466d42aa78970dbc,
+                          0x538925cdc8268f11,
+                          0x2a6e0c9e6d30c43c }),
+    // 13973538843621261113924259058427434053808430378163734641175100160836376897004
+    Fr::from_montgomery({ 0xb7a75a40232fe379,
+                          0x7a95ba9b979e9b35,
+                          0x93b16411b4067387,
+                          0x0c2647a281d2fbee }),
+    // 16395063164993626722686882727042150241125309409717445381854913964674649318585
+    Fr::from_montgomery({ 0x7e4b9a4404595cb4,
+                          0x5a4f084c1eb3a21e,
+                          0x173a0bb3e25bc61b,
+                          0x2dde352f82dcb0f5 }),
+    // 8465768840047024550750516678171433288207841931251654898809033371655109266663
+    Fr::from_montgomery({ 0xb6b77bd6f1705970,
+                          0xaf1c029785ba1eda,
+                          0x93e92e7ca921539d,
+                          0x086f26f7bce8820c }),
+    // 21345603324471810861925019445720576814602636473739003852898308205213912255830
+    Fr::from_montgomery({ 0x8d823d6beaf95c43,
+                          0x5ef00302e9c63bc7,
+                          0x63145ee4fa8d3f99,
+                          0x1121b4d91751036c }),
+    // 21171984405852590343970239018692870799717057961108910523876770029017785940991
+    Fr::from_montgomery({ 0xe9aee2c7814b3199,
+                          0xb537ac1d2611ec0e,
+                          0x1bbe517a12cffde9,
+                          0x2948555b5efc93d6 }),
+    // 10761027113757988230637066281488532903174559953630210849190212601991063767647
+    Fr::from_montgomery({ 0x47c52e9a34f2d0dc,
+                          0x47c49a33e8d9d971,
+                          0x40f442d6d333dcd6,
+                          0x15944561c2cce024 }),
+    // 6678298831065390834922566306988418588227382406175769592902974103663687992230
+    Fr::from_montgomery({ 0x292a6781bf745674,
+                          0x4c04ed03915bcd84,
+                          0x833e7bf0a8fa37c9,
+                          0x09ea436fb3126595 }),
+    // 4993662582188632374202316265508850988596880036291765531885657575099537176757
+    Fr::from_montgomery({ 0x2a111503125b42db,
+                          0xab5c77f682a76c33,
+                          0x2e0b8c9bcdb9456c,
+                          0x0a4d99ea2ab07fa5 }),
+    // 18364168158495573675698600238443218434246806358811328083953887470513967121206
+    Fr::from_montgomery({ 0xd71cdbf4f0bca762,
+                          0xbb4939238324ea49,
+                          0x8e36f7603cd44b3b,
+                          0x21e080f57e386da9 }),
+    // 3506345610354615013737144848471391553141006285964325596214723571988011984829
+    Fr::from_montgomery({ 0xf6eeff590543622e,
+                          0x86cce9192db44dc5,
+                          0x7475722dc537e2ff,
+                          0x1a459bb817267f1b }),
+    // 248732676202643792226973868626360612151424823368345645514532870586234380100
+    Fr::from_montgomery({ 0xe02ec3b88603fce6,
+                          0xbd4bf549bf563ee8,
+                          0x4753b5d4a6092d13,
+                          0x036a43bf2a1baaee }),
+    // 10090204501612803176317709245679152331057882187411777688746797044706063410969
+    Fr::from_montgomery({ 0x64c12efe1d3a8ca4,
+                          0xaac5c16b274eddb1,
+                          0xe50e14d3c828c8d8,
+                          0x0082e026829419bd }),
+    // 21297149835078365363970699581821844234354988617890041296044775371855432973500
+    Fr::from_montgomery({ 0xe6a201cad364e5ab,
+                          0x918f07af08cb6207,
+                          0xc52f818914ece6b9,
+                          0x18c46acd8b758e19 }),
+    // 16729368143229828574342820060716366330476985824952922184463387490091156065099
+    Fr::from_montgomery({ 0xb1e367bd46aa4700,
+                          0x387182380b097e0b,
+                          0x409207eb70c88b27,
+                          0x29385f03979d4f42 }),
+    // 4467191506765339364971058668792642195242197133011672559453028147641428433293
+    Fr::from_montgomery({ 0x4f44df3eaba34679,
+                          0x380e26d2ae99dc64,
+                          0x519234d6f80c3b9f,
+                          0x26c80e47192922c2 }),
+    // 8677548159358013363291014307402600830078662555833653517843708051504582990832
+    Fr::from_montgomery({ 0xf444b9c4d01c9066,
+                          0x8c0b5897e9f84f60,
+                          0x75d8cba4a0426065,
+                          0x04f7554f4ec93e23 }),
+    // 1022951765127126818581466247360193856197472064872288389992480993218645055345
+    Fr::from_montgomery({ 0x4b945387e7f9c761,
+                          0x2cfe9e4b947e44ca,
+                          0x5f490de322652f2c,
+                          0x139da6e6d57bfd57 }),
+    // 1888195070251580606973417065636430294417895423429240431595054184472931224452
+    Fr::from_montgomery({ 0xd4748c412c16a4ec,
+                          0xf210d34edef7e34d,
+                          0xf1b1eed8fe0cf556,
+                          0x2b29fa0667f7a240 }),
+    // 4221265384902749246920810956363310125115516771964522748896154428740238579824
+    Fr::from_montgomery({ 0xe97201c9d7d1bcde,
+                          0x8efe57b47aa05e8a,
+                          0x86d5afb8443266e9,
+                          0x1f0fd088d19147cd }),
+    // 2825393571154632139467378429077438870179957021959813965940638905853993971879
+    Fr::from_montgomery({ 0xeb2b12cf8a3cbe6d,
+                          0xada8b488374248d0,
+                          0xdfe4326556e32da4,
+                          0x2cc20a56358f3f26 }),
+    // 19171031072692942278056619599721228021635671304612437350119663236604712493093
+    Fr::from_montgomery({ 0xe55b9354cc0120a3,
+                          0x9159e5944ce6b65f,
+                          0x13ca9178b52f2933,
+                          0x17992a122b8e4047 }),
+    // 10780807212297131186617505517708903709488273075252405602261683478333331220733
+    Fr::from_montgomery({ 0xa5260d06e0e5b22d,
+                          0xf0b95f6a0f3de1fe,
+                          0x30ccd780a429b473,
+                          0x258da17c7980cbdf }),
+    // 18230936781133176044598070768084230333433368654744509969087239465125979720995
+    Fr::from_montgomery({ 0x86003372274b83cb,
+                          0xcecc5412dc0d41c7,
+                          0x624b2bd1797d4076,
+                          0x1015b7a220170b57 }),
+    // 16901065971871379877929280081392692752968612240624985552337779093292740763381
+    Fr::from_montgomery({ 0xa8841a83b02a72fb,
+                          0xb086036c85051f40,
+                          0x1a118d04498d520f,
+                          0x2fb70a2c4543c3ea }),
+    // 146494141603558321291767829522948454429758543710648402457451799015963102253
+    Fr::from_montgomery({ 0xb174986f67913a6b,
+                          0x5e94c38780b9bef3,
+                          0xdd17afa8c864416e,
+                          0x286cc46b8f2d9b6e }),
+    // 2492729278659146790410698334997955258248120870028541691998279257260289595548
+    Fr::from_montgomery({ 0x91196922e2c28c73,
+                          0xe8be3d4e4aef9799,
+                          0x5307f15eed2c6dbd,
+                          0x28d630f4a57c11ec }),
+    // 2204224910006646535594933495262085193210692406133533679934843341237521233504
+    Fr::from_montgomery({ 0x98f9cea6a3d4c55f,
+                          0xf600508c18f2db87,
+                          0x801016ce04a9a467,
+                          0x122bd1b90bccdad3 }),
+    // 16062117410185840274616925297332331018523844434907012275592638570193234893570
+    Fr::from_montgomery({ 0x81885699f46b8193,
+                          0xdcf671e1bed3b02e,
+                          0x79390292170136fc,
+                          0x2ac529acaece3584 }),
+    // 5894928453677122829055071981254202951712129328678534592916926069506935491729
+    Fr::from_montgomery({ 0xf2a87b084721fa82,
+                          0x1422d50a29ec1846,
+                          0xd0964e46f8cd2f5c,
+                          0x0eea9b61a21f8fe2 }),
+    // 4947482739415078212217504789923078546034438919537985740403824517728200332286
+    Fr::from_montgomery({ 0x05dd106710fb9286,
+                          0x15aa9d7d2c0e949a,
+                          0x75e019f3914b35bd,
+                          0x02c7a96d6b03bb5f }),
+    // 16143265650645676880461646123844627780378251900510645261875867423498913438066
+    Fr::from_montgomery({ 0x61d6478d0223f5af,
+                          0xad8070325675ea38,
+                          0x230efd1fe85b6515,
+                          0x0db7ba13cebb252a }),
+    // 397690828254561723549349897112473766901585444153303054845160673059519614409
+    Fr::from_montgomery({ 0x3b693504e0ae400e,
+                          0x371d8d326876d482,
+                          0x97d001779c04bf41,
+                          0x22a89d24d19397ad }),
+    // 11272653598912269895509621181205395118899451234151664604248382803490621227687
+    Fr::from_montgomery({ 0xafadc12bfcea2123,
+                          0x2d82a7d433994a74,
+                          0x5e7256e4fbd9237c,
+                          0x0c0b3584e81504b0 }),
+    // 15566927854306879444693061574322104423426072650522411176731130806720753591030
+    Fr::from_montgomery({ 0x9dc36a6d262bd411,
+                          0x1809a8166efc179d,
+                          0x4688945002f9f678,
+                          0x1015e12be85132dd }),
+    // 14222898219492484180162096141564251903058269177856173968147960855133048449557
+    Fr::from_montgomery({ 0x7126aed11203cf55,
+                          0x744f5d74a7e48064,
+                          0xb208690f9a9a66dd,
+                          0x12f830cce6982639 }),
+    // 16690275395485630428127725067513114066329712673106153451801968992299636791385
+    Fr::from_montgomery({ 0x2884653e408706af,
+                          0x03d81b3641a627dd,
+                          0x730a7a0377252d2e,
+                          0x0e75dbb3bf876d56 }),
+    // 3667030990325966886479548860429670833692690972701471494757671819017808678584
+    Fr::from_montgomery({ 0xc3383f5eaccedf90,
+                          0xb78826995fccbee3,
+                          0xcf15f0da403c3735,
+                          0x14d86143e6514cfa }),
+    // 21280039024501430842616328642522421302481259067470872421086939673482530783142
+    Fr::from_montgomery({ 0x686012440cc294fd,
+                          0x46b37410f5511d76,
+                          0x5a5a87837ebb2df6,
+                          0x0ad2a865b04b6ea5 }),
+    // 15895485136902450169492923978042129726601461603404514670348703312850236146328
+    Fr::from_montgomery({ 0x05ab90543f7ae7a6,
+                          0xb0669c9d41dc96e2,
+                          0x2988078befee0ec9,
+                          0x1061f470678e82b9 }),
+    // 7733050956302327984762132317027414325566202380840692458138724610131603812560
+    Fr::from_montgomery({ 0x08369d640ba64b70,
+                          0xfd813c56ee0bbb76,
+                          0x952c94157a13c384,
+                          0x22ce78a79f23c0fd }),
+    // 438123800976401478772659663183448617575635636575786782566035096946820525816
+    Fr::from_montgomery({ 0xaedb5435ebd53a31,
+                          0xe3ad17155700036e,
+                          0x9d1d17d463871ea6,
+                          0x28adca358fb7ae1a }),
+    // 814913922521637742587885320797606426167962526342166512693085292151314976633
+    Fr::from_montgomery({ 0x096e2a267007b7ea,
+                          0x3a6fc10d6657611c,
+                          0x35d01ca33837e35a,
+                          0x043726b7bc8cfa85 }),
+    // 12368712287081330853637674140264759478736012797026621876924395982504369598764
+    Fr::from_montgomery({ 0x8e0499db551c03d3,
+                          0x51e0de9c726b3635,
+                          0xca00966828441e78,
+                          0x08634fa6d8f09ce5 }),
+    // 2494806857395134874309386694756263421445039103814920780777601708371037591569
+    Fr::from_montgomery({ 0xfff0e43ab04abda7,
+                          0x58ab1291d78e121b,
+                          0xb944b6fb6e7bd244,
+                          0x20eb7bcd0fd0544c }),
+    // 16101132301514338989512946061786320637179843435886825102406248183507106312877
+    Fr::from_montgomery({ 0x0dfc00ce5fb01636,
+                          0x94433821777406e8,
+                          0xdde8b1d4ad2196cd,
+                          0x12d1cede233b07dc }),
+    // 6252650284989960032925831409804233477770646333900692286731621844532438095656
+    Fr::from_montgomery({ 0xda4d77b70bf95f52,
+                          0x78cd16a3c3d5a1f4,
+                          0x79913c4b122dd6c5,
+                          0x041a4a53c9ea3b26 }),
+    // 9277135875276787021836189566799935097400042171346561246305113339462708861695
+    Fr::from_montgomery({ 0xdea1eb19afd322ff,
+                          0xc01224db223bf241,
+                          0xb8c37173c70e908e,
+                          0x206bb6538f29f5a7 }),
+    // 10493603554686607050979497281838644324893776154179810893893660722522945589063
+    Fr::from_montgomery({ 0x01b0068e49caa3a2,
+                          0x6e9dc08abf989e2a,
+                          0x1e4f973be52fda9c,
+                          0x2abcc3f893810d35 }),
+    // 8673089750662709235894359384294076697329948991010184356091130382437645649279
+    Fr::from_montgomery({ 0x81d183fe9b2cba98,
+                          0xd6c9e52ca8605b22,
+                          0xec784769205cb946,
+                          0x0f65129ada2d5f49 }),
+    // 9558393272910366944245875920138649617479779893610128634419086981339060613250
+    Fr::from_montgomery({ 0xd6bdda7a673ea276,
+                          0x738f6aa9b43f663e,
+                          0xb8d6993f9ddb2ab0,
+                          0x27d01e6d82510161 }),
+    // 19012287860122586147374214541764572282814469237161122489573881644994964647218
+    Fr::from_montgomery({ 0xb5a849b9d34c1df8,
+                          0xc727d186bb97901d,
+                          0x344e5bc14fd202d5,
+                          0x21cf7747bcd701de }),
+    // 9783723818270121678386992630754842961728702994964214799008457449989291229500
+    Fr::from_montgomery({ 0x0735affe5bf14012,
+                          0x59e197aede5b5ce6,
+                          0xa0387182634eea8f,
+                          0x24e62ee220d2b34e }),
+    // 15550788416669474113213749561488122552422887538676036667630838378023479382689
+    Fr::from_montgomery({ 0x63b2e703a078042f,
+                          0x9549dd320e6bbb7b,
+                          0xa772b86f0726b49d,
+                          0x130500fe2fa739ed }),
+    // 15016165746156232864069722572047169071786333815661109750860165034341572904221
+    Fr::from_montgomery({ 0xd2649e6ff95a01bb,
+                          0x59451fabdb7e94e0,
+                          0xb12b27d7382c8405,
+                          0x080e487ea5101e47 }),
+    // 6506225705710197163670556961299945987488979904603689017479840649664564978574
+    Fr::from_montgomery({ 0xe29f3abcf63fcda9,
+                          0x8e13a8a234a8b9e6,
+                          0x608b26869c6dd5b1,
+                          0x05d788ee55cf8cf1 }),
+    // 10796631184889302076168355684722130903785890709107732067446714470783437829037
+    Fr::from_montgomery({ 0xa7ed95414956e8a7,
+                          0x5ea98d9cfaf12b9f,
+                          0x0ae6f7557687cb0a,
+                          0x219cecf5e2c20ccd }),
+    // 19871836214837460419845806980869387567383718044439891735114283113359312279540
+    Fr::from_montgomery({ 0x3d36b51bb8a4aa85,
+                          0x8ff5943226127d58,
+                          0xbce70b2da328c084,
+                          0x041c294e9d61a0db }),
+    // 20871081766843466343749609089986071784031203517506781251203251608363835140622
+    Fr::from_montgomery({ 0x5875248128d45042,
+                          0xe00bdd9acb70cfab,
+                          0xa62748581dae3d2f,
+                          0x22f52f18a78718bc }),
+    // 5100105771517691442278432864090229416166996183792075307747582375962855820797
+    Fr::from_montgomery({ 0x81841d243f4da81a,
+                          0xf9974ab874e92ec5,
+                          0x771bf866a10f8f60,
+                          0x24986f01c65d94d0 }),
+    // 8777887112076272395250620301071581171386440850451972412060638225741125310886
+    Fr::from_montgomery({ 0x4824ce38f9d508d2,
+                          0xf35741eaff3bd57d,
+                          0x89207f0151eaa95d,
+                          0x1e58572fc6a0860d }),
+    // 5300440870136391278944213332144327695659161151625757537632832724102670898756
+    Fr::from_montgomery({ 0xc859dbbd699af660,
+                          0xaa2e4bfb6d76ccb7,
+                          0xe51923c209b78d2b,
+                          0x2d9131fdfcd1fd71 }),
+    // 1205448543652932944633962232545707633928124666868453915721030884663332604536
+    Fr::from_montgomery({ 0x96460b070984d780,
+                          0xd9388a9593f26b44,
+                          0x264b627df2afec89,
+                          0x210a4ca27e64d04b }),
+    // 5542499997310181530432302492142574333860449305424174466698068685590909336771
+    Fr::from_montgomery({ 0xf2998117f7ecd09a,
+                          0x48ad26caa9ca76cd,
+                          0x3dff57b82c42e9cb,
+                          0x1db0a2c85010cc8a }),
+    // 11028094245762332275225364962905938096659249161369092798505554939952525894293
+    Fr::from_montgomery({ 0xa5bf6f7518930def,
+                          0x79b425ccb3cc6452,
+                          0x30bb6a8dc345e4c1,
+                          0x2f2688b80ccfabb8 }),
+    // 19187314764836593118404597958543112407224947638377479622725713735224279297009
+    Fr::from_montgomery({ 0xaeff02b1c6490c40,
+                          0xe4f122bae1e7c669,
+                          0xc1799e347023f5d9,
+                          0x25841d66960c4e53 }),
+    // 17047263688548829001253658727764731047114098556534482052135734487985276987385
+    Fr::from_montgomery({ 0x4d779dc9152853ee,
+                          0xbf2a64051f5c13e1,
+                          0x956c12f3a1dde264,
+                          0x08abe6983a80ea28 }),
+    // 19914849528178967155534624144358541535306360577227460456855821557421213606310
+    Fr::from_montgomery({ 0xdfac18ca95164b53,
+                          0x872167ac80b23992,
+                          0xb12a24b617ba9f25,
+                          0x007d3da4bc5c0dd2 }),
+    // 2929658084700714257515872921366736697080475676508114973627124569375444665664
+    Fr::from_montgomery({ 0xc51bb967ecf388fe,
+                          0x420f0b3c871d51b1,
+                          0x89c520fdcb563b05,
+                          0x156873246a76682e }),
+    // 15092262360719700162343163278648422751610766427236295023221516498310468956361
+    Fr::from_montgomery({ 0x5e2e16ea213bf71f,
+                          0xfa9108a216a1c0e2,
+                          0x9aae88429a6b3b1c,
+                          0x28f0ea8a82630f56 }),
+    // 21578580340755653236050830649990190843552802306886938815497471545814130084980
+    Fr::from_montgomery({ 0xce54d283994854ce,
+                          0x1c1b26330ccf0a69,
+                          0xa01e532a5b71a067,
+                          0x0e28a4fc7c2bd839 }),
+    // 1258781501221760320019859066036073675029057285507345332959539295621677296991
+    Fr::from_montgomery({ 0x54547ff1278c93a1,
+                          0x96fd17660a16ccc1,
+                          0x459d487c329350a6,
+                          0x2bf4e45c3e6f318b }),
+    // 3819598418157732134449049289585680301176983019643974929528867686268702720163
+    Fr::from_montgomery({ 0xdbe76c4d9245dece,
+                          0xd2afbc6ac5291542,
+                          0xbaaaf630c01a5253,
+                          0x1b6ab48fafe8fcd0 }),
+    // 8653175945487997845203439345797943132543211416447757110963967501177317426221
+    Fr::from_montgomery({ 0xcedeee1c3cc2e045,
+                          0x591cfbd622859078,
+                          0x348a77a5ab615af8,
+                          0x13fd02ad6b8b3f12 }),
+    // 6614652990340435611114076169697104582524566019034036680161902142028967568142
+    Fr::from_montgomery({ 0x674394fb457d2344,
+                          0xb458c45c0db99224,
+                          0xd18787e083bec4ad,
+                          0x2672f704c4b607e1 }),
+    // 19212515502973904821995111796203064175854996071497099383090983975618035391558
+    Fr::from_montgomery({ 0xe20f3a2ccc99b6ba,
+                          0x3f9bcc3e57490f04,
+                          0x5291a7a982f53137,
+                          0x107a53c45e19bcff }),
+    // 18664315914479294273286016871365663486061896605232511201418576829062292269769
+    Fr::from_montgomery({ 0x5d78dcd35b7babd4,
+                          0xabf1d817dd25f065,
+                          0x280324373a1bb827,
+                          0x1a04b3857955e3ca }),
+    // 11498264615058604317482574216318586415670903094838791165247179252175768794889
+    Fr::from_montgomery({ 0xbbf3881f6ac16990,
+                          0x220fdb71817a9da9,
+                          0x5d0703c7e4818c98,
+                          0x0c36b559f64cba6a }),
+    // 10814026414212439999107945133852431304483604215416531759535467355316227331774
+    Fr::from_montgomery({ 0x834094065b149350,
+                          0x345cf8c48092d2ed,
+                          0xeb5c15d892eaa686,
+                          0x25aae90755f3a4a5 }),
+    // 17566185590731088197064706533119299946752127014428399631467913813769853431107
+    Fr::from_montgomery({ 0x69b5ae8c82660342,
+                          0x716a2c1eaa365397,
+                          0x7eac1772682cee1f,
+                          0x2e93b8dfb632865e }),
+    // 14016139747289624978792446847000951708158212463304817001882956166752906714332
+    Fr::from_montgomery({ 0x20ba991a9238dffb,
+                          0xf285e1e17406c9f8,
+                          0x0dc80059f50fccdc,
+                          0x2c3d2effbb457714 }),
+    // 8242601581342441750402731523736202888792436665415852106196418942315563860366
+    Fr::from_montgomery({ 0xd9a8750d2ce310f5,
+                          0x2224b344d45cc35a,
+                          0x8119bdaa0113e4f1,
+                          0x28d08f5064280e83 }),
+    // 9244680976345080074252591214216060854998619670381671198295645618515047080988
+    Fr::from_montgomery({ 0xadc391fefcbd7769,
+                          0xe18302406e6b5aa6,
+                          0x5e705022c80247b4,
+                          0x1415329f0498ee94 }),
+    // 12216779172735125538689875667307129262237123728082657485828359100719208190116
+    Fr::from_montgomery({ 0xd855686eccc98ca8,
+                          0xf8c31fc019a785d0,
+                          0xbc112280cf797638,
+                          0x24fd8b29ed3b4f5b }),
+    // 10702811721859145441471328511968332847175733707711670171718794132331147396634
+    Fr::from_montgomery({ 0x51f89eecc416bd33,
+                          0x1f39a20ac369dbc9,
+                          0x9c5abd628e23654c,
+                          0x27ec2739870fb66c }),
+    // 6479667912792222539919362076122453947926362746906450079329453150607427372979
+    Fr::from_montgomery({ 0x3c3b6176f51c5761,
+                          0x7757f8a2f832573f,
+                          0xe0d62e2fcf644215,
+                          0x2afb0f24ee6e04c3 }),
+    // 15117544653571553820496948522381772148324367479772362833334593000535648316185
+    Fr::from_montgomery({ 0x8a659177b1b76405,
+                          0xecb4852fef8c0055,
+                          0x32553592c735f9c9,
+                          0x275bc85bb103d888 }),
+    // 6842203153996907264167856337497139692895299874139131328642472698663046726780
+    Fr::from_montgomery({ 0xb4f87ed362cf1bd4,
+                          0xb4597f912dec95bc,
+                          0x5dd3daef5b67a771,
+                          0x0742afa8cf593fdb }),
+    // 12732823292801537626009139514048596316076834307941224506504666470961250728055
+    Fr::from_montgomery({ 0x03c83f37b1abef19,
+                          0x34fa98b943c8c980,
+                          0x71908cac51965acf,
+                          0x2ede84d5eabfb221 }),
+    // 6936272626871035740815028148058841877090860312517423346335878088297448888663
+    Fr::from_montgomery({ 0x1f0ae806aab64578,
+                          0x3b237c663066d6d1,
+                          0xfe227d444d102af3,
+                          0x0612da87ad62c928 }),
+    // 17297554111853491139852678417579991271009602631577069694853813331124433680030
+    Fr::from_montgomery({ 0xc1b0a5f186225e48,
+                          0x58cf44effbef61f5,
+                          0xde4cc889fb4d7ce5,
+                          0x172b1bfa1bdae39f }),
+    // 16641596134749940573104316021365063031319260205559553673368334842484345864859
+    Fr::from_montgomery({ 0x58d6d5b3c3379839,
+                          0x0586c2ffa1872357,
+                          0x883ba9c9cfa2d4b7,
+                          0x0e5a05dfa3cc4522 }),
+    // 7400481189785154329569470986896455371037813715804007747228648863919991399081
+    Fr::from_montgomery({ 0xb96ed53c83943057,
+                          0xa6658acac745e497,
+                          0x08b06904974b5751,
+                          0x235db6a944bfad8d }),
+    // 2273205422216987330510475127669563545720586464429614439716564154166712854048
+    Fr::from_montgomery({ 0x00ee1c9fa962ce66,
+                          0x1df7c2a459872bb7,
+                          0x2cb1e67b730c9955,
+                          0x1a7a04f9b6ef8ecd }),
+    // 15162538063742142685306302282127534305212832649282186184583465569986719234456
+    Fr::from_montgomery({ 0xfa0e418d3980d8bf,
+                          0x5717d60752ea4fa5,
+                          0x8ae5fc268377242a,
+                          0x05c8bd8b29d49f88 }),
+    // 5628039096440332922248578319648483863204530861778160259559031331287721255522
+    Fr::from_montgomery({ 0x3f208ef6b5b9f044,
+                          0xcfa3e7a4601c6549,
+                          0x4ae3a6cef17c42e1,
+                          0x128bdf354bf863c8 }),
+    // 16085392195894691829567913404182676871326863890140775376809129785155092531260
+    Fr::from_montgomery({ 0x98166cc1b926fd2d,
+                          0xe88305e430777afd,
+                          0xf605b101ea58011b,
+                          0x0a7b34763aefe8ac }),
+    // 14227467863135365427954093998621993651369686288941275436795622973781503444257
+    Fr::from_montgomery({ 0x7c0d8b16f1b91a6c,
+                          0xde6cc14855988603,
+                          0x24a9496574bc585f,
+                          0x2d55da597f53711a }),
+    // 18224457394066545825553407391290108485121649197258948320896164404518684305122
+    Fr::from_montgomery({ 0xf8101716c76bd8b9,
+                          0x04cdc31f6a751b52,
+                          0x520425beb73aafbe,
+                          0x1efe7d901eeac214 }),
+    // 274945154732293792784580363548970818611304339008964723447672490026510689427
+    Fr::from_montgomery({ 0xa2d9881dda6a9954,
+                          0x5d185981d28b3c51,
+                          0x70dcb109330d4bab,
+                          0x1800ec01eb6c0189 }),
+    // 11050822248291117548220126630860474473945266276626263036056336623671308219529
+    Fr::from_montgomery({ 0x1454028f3acb0509,
+                          0x2a20ca646ebb1fc7,
+                          0x54075e55c6e609fc,
+                          0x0335af83ac502719 }),
+    // 2119542016932434047340813757208803962484943912710204325088879681995922344971
+    Fr::from_montgomery({ 0x93a2a347211aa972,
+                          0xc6e712a7fd8cd51c,
+                          0x27ff2d980ef2caad,
+                          0x21b68a2314cf32ee })
+};
+
+}
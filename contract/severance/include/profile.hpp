@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+// Per-stage cost counters of the verifiers, compiled in with
+// SEVERANCE_PROFILE and empty otherwise.
+//
+// A stage is entered with PROFILE_STAGE(STAGE_...) and lasts until the end
+// of the enclosing block, or until PROFILE_NEXT(STAGE_...) moves the rest
+// of the block to another stage. Host calls, and Fr multiplications and inversions
+// done in wasm, are counted against the innermost stage. Native builds also
+// record the time spent in each stage; a contract has no clock to read.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace profile {
+
+enum stage_t
+{
+    STAGE_OTHER,
+    STAGE_CHALLENGES,
+    STAGE_LAGRANGE,
+    STAGE_SCALARS,
+    STAGE_MSM,
+    STAGE_PAIRING,
+    STAGE_COUNT
+};
+
+typedef struct
+{
+    uint32_t field_mul;
+    uint32_t field_inv;
+    uint32_t alt_bn128_add;
+    uint32_t alt_bn128_mul;
+    uint32_t alt_bn128_pair;
+    uint32_t keccak;
+    uint64_t ns;
+} counters_t;
+
+// One line of a report, the action return value of verifycost.
+struct stage_report
+{
+    std::string stage;
+    uint32_t field_mul;
+    uint32_t field_inv;
+    uint32_t alt_bn128_add;
+    uint32_t alt_bn128_mul;
+    uint32_t alt_bn128_pair;
+    uint32_t keccak;
+    uint64_t ns;
+};
+
+#if defined(SEVERANCE_PROFILE)
+
+extern counters_t counters[STAGE_COUNT];
+extern stage_t current;
+
+void
+reset();
+
+// The stages with any cost, in stage order.
+std::vector<stage_report>
+report();
+
+void
+print_report();
+
+// Charges the time since the last switch to the current stage and makes
+// stage the current one.
+void
+switch_to(stage_t stage);
+
+class stage_scope
+{
+  public:
+    explicit stage_scope(stage_t stage)
+      : outer(current)
+    {
+        switch_to(stage);
+    }
+
+    ~stage_scope() { switch_to(outer); }
+
+  private:
+    stage_t outer;
+};
+
+#define PROFILE_STAGE(stage) profile::stage_scope _profile_stage(profile::stage)
+#define PROFILE_NEXT(stage) profile::switch_to(profile::stage)
+#define PROFILE_COUNT(counter) profile::counters[profile::current].counter++
+
+#else
+
+#define PROFILE_STAGE(stage)
+#define PROFILE_NEXT(stage)
+#define PROFILE_COUNT(counter)
+
+#endif
+
+} // namespace profile
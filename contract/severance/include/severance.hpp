@@ -23,6 +23,10 @@
 #pragma once
 
 #include <eosio/eosio.hpp>
+#include <fflonk_verifier.hpp>
+#include <groth16_verifier.hpp>
+#include <profile.hpp>
+#include <verifier.hpp>
 
 using namespace eosio;
 using namespace intx::literals;
@@ -43,18 +47,124 @@ CONTRACT severance : public contract
 
     [[eosio::action]] void deposit(
       name owner, asset quantity, std::vector<char> & commitment_data);
-    [[eosio::action]] void withdraw(std::vector<char> & proof_data,
-                                    std::vector<std::vector<char>> &
-                                      public_inputs,
+    [[eosio::action]] void withdraw(withdraw_proof & proof_data,
+                                    withdraw_inputs & public_inputs,
                                     name owner,
                                     name to,
                                     eosio::asset quantity,
                                     std::string memo);
 
+    // withdraw with the proof points compressed, for less NET.
+    [[eosio::action]] void withdrawc(withdraw_proof_compressed & proof_data,
+                                     withdraw_inputs & public_inputs,
+                                     name owner,
+                                     name to,
+                                     eosio::asset quantity,
+                                     std::string memo);
+
+    // The checks of a withdrawal, cheapest first, so that spam and double
+    // spends are turned away before any proof is verified. A rejection
+    // reverts the transaction and anything it would have counted, so each
+    // error message is prefixed with the name of its stage instead, for
+    // relayers and node logs to count rejections by.
+    enum withdraw_stage : uint8_t
+    {
+        WITHDRAW_ARGS,     // quantity, recipient, memo, proof system
+        WITHDRAW_ENCODING, // public inputs, evaluations and points
+        WITHDRAW_STATE,    // root hash and nullifier lookups
+        WITHDRAW_PROOF,    // the verifier
+        WITHDRAW_OK,       // passed every stage, only in withdraw_check
+    };
+
+    struct withdraw_check
+    {
+        bool valid;
+        uint8_t stage; // withdraw_stage of the rejection, or WITHDRAW_OK
+        std::string error;
+    };
+
+    // Runs the checks of withdraw, without the owner's authorization, and
+    // returns the first rejection instead of failing. For relayers to try a
+    // proof before paying for the transaction; changes no state.
+    [[eosio::action, eosio::read_only]] withdraw_check checkwithdraw(
+      withdraw_proof & proof_data,
+      withdraw_inputs & public_inputs,
+      name to,
+      eosio::asset quantity,
+      std::string memo);
+
+    // checkwithdraw for withdrawc, withdrawff and withdrawgro.
+    [[eosio::action, eosio::read_only]] withdraw_check checkwithdrawc(
+      withdraw_proof_compressed & proof_data,
+      withdraw_inputs & public_inputs,
+      name to,
+      eosio::asset quantity,
+      std::string memo);
+    [[eosio::action, eosio::read_only]] withdraw_check checkwithdrawff(
+      fflonk_proof & proof_data,
+      withdraw_inputs & public_inputs,
+      name to,
+      eosio::asset quantity,
+      std::string memo);
+    [[eosio::action, eosio::read_only]] withdraw_check checkwithdrawgro(
+      groth16_proof & proof_data,
+      withdraw_inputs & public_inputs,
+      name to,
+      eosio::asset quantity,
+      std::string memo);
+
+    // A withdrawal from a pool that verifies FFLONK proofs.
+    [[eosio::action]] void withdrawff(fflonk_proof & proof_data,
+                                      withdraw_inputs & public_inputs,
+                                      name owner,
+                                      name to,
+                                      eosio::asset quantity,
+                                      std::string memo);
+
+    // A withdrawal from a pool that verifies Groth16 proofs.
+    [[eosio::action]] void withdrawgro(groth16_proof & proof_data,
+                                       withdraw_inputs & public_inputs,
+                                       name owner,
+                                       name to,
+                                       eosio::asset quantity,
+                                       std::string memo);
+
+    struct withdrawal
+    {
+        withdraw_proof proof_data;
+        withdraw_inputs public_inputs;
+        name to;
+        std::string memo;
+    };
+
+    // Several withdrawals from the same pool, verified with one pairing
+    // check. All of them succeed or the action fails.
+    [[eosio::action]] void withdrawbatch(
+      std::vector<withdrawal> & withdrawals, name owner, eosio::asset quantity);
+
+    // The proof systems a pool can take withdrawals in. Pools that were never
+    // configured use PLONK.
+    enum verifier_type : uint8_t
+    {
+        VERIFIER_PLONK = 0,
+        VERIFIER_FFLONK = 1,
+        VERIFIER_GROTH16 = 2,
+    };
+
+    // Selects the proof system of the pool of quantity.
+    [[eosio::action]] void setverifier(asset quantity, uint8_t verifier);
+
 #ifdef ALLOW_RESET
     ACTION reset(name scope);
 #endif
 
+#ifdef SEVERANCE_PROFILE
+    // Verifies a PLONK withdraw proof and returns, and prints, the host calls
+    // and field operations of each verifier stage. Changes no state.
+    [[eosio::action]] std::vector<profile::stage_report> verifycost(
+      withdraw_proof & proof_data, withdraw_inputs & public_inputs);
+#endif
+
   private:
     struct [[eosio::table]] commitment
     {
@@ -115,6 +225,14 @@ CONTRACT severance : public contract
         uint64_t primary_key() const { return id; }
     };
 
+    struct [[eosio::table]] poolconfig
+    {
+        uint64_t scope;
+        uint8_t verifier;
+
+        uint64_t primary_key() const { return scope; }
+    };
+
     typedef eosio::multi_index<
       "commitment"_n,
       commitment,
@@ -139,6 +257,7 @@ CONTRACT severance : public contract
     typedef eosio::multi_index<"globalstatee"_n, globalstateext>
       global_states_ext_t;
     typedef eosio::multi_index<"globalfee"_n, globalfee> global_fee_t;
+    typedef eosio::multi_index<"poolconfig"_n, poolconfig> pool_config_t;
 
     severance::globalstate* get_global_state(uint64_t scope);
     void set_global_state(uint64_t scope, const globalstate& gs);
@@ -155,41 +274,61 @@ CONTRACT severance : public contract
     static uint64_t calculate_fees(
       const severance::globalstateext* global_state_ext, asset& quantity);
 
-    intx::uint256 get_last_level_hash(uint64_t scope, int level);
-    void set_last_level_hash(uint64_t scope, int level, intx::uint256 hash);
+    // The outcome of a withdraw check; error is null when it passed.
+    struct check_result
+    {
+        uint8_t stage = 0;
+        const char* error = nullptr;
 
-    const intx::uint256 level_defaults[32] = {
-        30238598704088929952843927706569847911599885956104611274912160341490286246718_u256,
-        25348422377004321007059927731081793746945139569114277883447014548301570270860_u256,
-        16401820946464185137346357874373090990568111992633083038764169830345921227085_u256,
-        7508103525080351137382699802863531575643180572162613318007798684988341228268_u256,
-        17960896985569549954477100205393164871173002812946988710438960683597028440922_u256,
-        29464911409920719015583702742677733245455761112275208147876304472374171736419_u256,
-        20365738626542439140784808616660262904197432804351602887389291635706005230479_u256,
-        50094012655666739741757742535708299725511612220888959669209674245779430795631_u256,
-        84481084991077554297473579297547823130151822028357513698940834088946031994428_u256,
-        65009568646014927574600477453219176146218298364363007468316186649830384869270_u256,
-        74568519575760023398099891318741317344911244404916721780423199270529518060223_u256,
-        28474002570249281395440345236610297023194847909993280485202899395592828940126_u256,
-        40230313923982849562834343028524642933574573334910634629678156674487064379057_u256,
-        16463665069615288234635515866443739209783239800818597114164287502048789052464_u256,
-        39326964221197219404313764098995068225350845039661696346190141178267408599237_u256,
-        56128881384580835253363759507703601545282399300749662091723162625648919231395_u256,
-        71651674210086931308216423199077829219568676225701481144725097391774503208581_u256,
-        11291812394179869221746248061886328562378471618543727288534038397673199316212_u256,
-        91768241568601166219390796547719868152960074702606000299649710606134403570387_u256,
-        113866854053749903300333619484139229603952452549894060841070478621193462325348_u256,
-        12900939506777163752908550726884953820264260341613592165124627336667450505012_u256,
-        77792729128822647523914437850871477814352129948361548129548545876643770001468_u256,
-        8550899905673560156874502538901844408321725334814212168646676121448800494749_u256,
-        68075794184097345106241543125282550400004595546658124757342479691208462448155_u256,
-        52051519765640516569026227651220681577251574921757729650704331930922152451705_u256,
-        60439906622495289412129553804980598395101411861085333741828968014406524398960_u256,
-        43838341704056268159122126764160763495039233876411520978708515517865358045820_u256,
-        20769327482353150733803221965915847256410246352105945946711490529511199296334_u256,
-        90854336653446787628791047493176183662724257943649508657425729023284934684385_u256,
-        104113848206815522990854469768913042028817956314155575532193413111187726944706_u256,
-        99687557887186228995941237085927827806810202766788290430077136634416942660613_u256,
-        7333656426618417692843107199562353793827654602322450949288455009300229501943_u256
+        bool failed() const { return error != nullptr; }
     };
+
+    // check() on a result, with the error prefixed by the stage name.
+    static void require(const check_result& result);
+    static withdraw_check to_withdraw_check(const check_result& result);
+
+    uint8_t get_verifier(uint64_t scope);
+    check_result check_withdraw_args(const asset& quantity, uint64_t& scope);
+    static check_result check_withdraw_inputs(
+      const withdraw_inputs& public_inputs,
+      name to,
+      const std::string& memo,
+      public_inputs_t& inputs);
+    check_result check_withdraw_verifier(uint64_t scope, uint8_t verifier);
+    check_result check_withdraw_request(const asset& quantity,
+                                        uint8_t verifier,
+                                        const withdraw_inputs& public_inputs,
+                                        name to,
+                                        const std::string& memo,
+                                        uint64_t& scope,
+                                        public_inputs_t& inputs);
+    check_result check_withdraw_state(uint64_t scope,
+                                      const std::array<char, 32>& root_data,
+                                      const checksum256& nullifier_hash);
+    check_result check_plonk_withdrawal(uint64_t scope,
+                                        const withdraw_proof& proof_data,
+                                        const withdraw_inputs& public_inputs,
+                                        const public_inputs_t& inputs);
+    check_result check_compressed_withdrawal(
+      uint64_t scope,
+      const withdraw_proof_compressed& proof_data,
+      const withdraw_inputs& public_inputs,
+      const public_inputs_t& inputs);
+    check_result check_fflonk_withdrawal(uint64_t scope,
+                                         const fflonk_proof& proof_data,
+                                         const withdraw_inputs& public_inputs,
+                                         const public_inputs_t& inputs);
+    check_result check_groth16_withdrawal(uint64_t scope,
+                                          const groth16_proof& proof_data,
+                                          const withdraw_inputs& public_inputs,
+                                          const public_inputs_t& inputs);
+    void cash_out(uint64_t scope,
+                  name owner,
+                  const checksum256& nullifier_hash,
+                  name to,
+                  const asset& quantity,
+                  const std::string& memo);
+
+    intx::uint256 get_last_level_hash(uint64_t scope, int level);
+    void set_last_level_hash(uint64_t scope, int level, intx::uint256 hash);
 };
\ No newline at end of file
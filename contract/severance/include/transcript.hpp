@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <eosio/crypto.hpp>
+#include <eosio/crypto_ext.hpp>
+#include <field.hpp>
+#include <profile.hpp>
+
+#if defined(SEVERANCE_NATIVE_KECCAK)
+#include <host.hpp>
+#endif
+
+// Fiat-Shamir transcript over Keccak-256. The bytes of a round are absorbed,
+// then squeeze() hashes them into a challenge and starts the next round: the
+// snarkjs PLONK transcript hashes every round on its own, and a challenge
+// that depends on an earlier one absorbs it explicitly.
+//
+// The digest becomes a field element through Fr::load, a single Montgomery
+// multiplication by R^2 that accepts any 256-bit value, rather than % q.
+//
+// Hashing is left to a backend with absorb(data, size) and a finish() that
+// returns the digest and resets it:
+//  - keccak_buffer gathers the round in a fixed buffer for the one-shot
+//    keccak host function; this is the on-chain backend.
+//  - host::keccak_sponge, in the native build, streams into a software
+//    Keccak state and needs no buffer.
+// Neither allocates.
+
+template<std::size_t Capacity>
+class keccak_buffer
+{
+  public:
+    void absorb(const void* data, std::size_t size)
+    {
+        eosio::check(length + size <= Capacity, "transcript overflow");
+        memcpy(buffer + length, data, size);
+        length += size;
+    }
+
+    eosio::checksum256 finish()
+    {
+        const std::size_t size = length;
+        length = 0;
+        return eosio::keccak(buffer, size);
+    }
+
+  private:
+    char buffer[Capacity];
+    std::size_t length = 0;
+};
+
+template<typename Hasher>
+class basic_transcript
+{
+  public:
+    void absorb(const char* data, std::size_t size)
+    {
+        hasher.absorb(data, size);
+    }
+
+    template<std::size_t N>
+    void absorb(const std::array<char, N>& data)
+    {
+        hasher.absorb(data.data(), N);
+    }
+
+    void absorb(const Fr& x)
+    {
+        uint8_t b[32];
+        x.store(b);
+        hasher.absorb(b, 32);
+    }
+
+    Fr squeeze()
+    {
+        PROFILE_COUNT(keccak);
+        const auto digest = hasher.finish().extract_as_byte_array();
+        return Fr::load(digest.data());
+    }
+
+  private:
+    Hasher hasher;
+};
+
+// A transcript for rounds of at most Capacity bytes.
+#if defined(SEVERANCE_NATIVE_KECCAK)
+template<std::size_t Capacity>
+using transcript = basic_transcript<host::keccak_sponge>;
+#else
+template<std::size_t Capacity>
+using transcript = basic_transcript<keccak_buffer<Capacity>>;
+#endif
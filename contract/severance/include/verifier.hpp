@@ -22,27 +22,88 @@
 
 #pragma once
 
+#include <array>
+#include <constants.hpp>
+#include <curve.hpp>
 #include <eosio/eosio.hpp>
+#include <field.hpp>
 #include <intx.h>
 
+// A withdraw proof as it is laid out in the action data: nine G1 points as
+// x then y, and seven evaluations, all 32-byte big endian numbers. The
+// fields are fixed-size arrays, so the action argument is unpacked without
+// heap allocations and the verifier reads the points in place.
+struct withdraw_proof
+{
+    std::array<char, 64> A;
+    std::array<char, 64> B;
+    std::array<char, 64> C;
+    std::array<char, 64> Z;
+    std::array<char, 64> T1;
+    std::array<char, 64> T2;
+    std::array<char, 64> T3;
+    std::array<char, 64> Wxi;
+    std::array<char, 64> Wxiw;
+    std::array<char, 32> eval_a;
+    std::array<char, 32> eval_b;
+    std::array<char, 32> eval_c;
+    std::array<char, 32> eval_s1;
+    std::array<char, 32> eval_s2;
+    std::array<char, 32> eval_zw;
+    std::array<char, 32> eval_r;
+};
+
+// A withdraw_proof with its points compressed, 512 bytes instead of 800.
+// The evaluations are as in withdraw_proof.
+struct withdraw_proof_compressed
+{
+    g1_compressed_t A;
+    g1_compressed_t B;
+    g1_compressed_t C;
+    g1_compressed_t Z;
+    g1_compressed_t T1;
+    g1_compressed_t T2;
+    g1_compressed_t T3;
+    g1_compressed_t Wxi;
+    g1_compressed_t Wxiw;
+    std::array<char, 32> eval_a;
+    std::array<char, 32> eval_b;
+    std::array<char, 32> eval_c;
+    std::array<char, 32> eval_s1;
+    std::array<char, 32> eval_s2;
+    std::array<char, 32> eval_zw;
+    std::array<char, 32> eval_r;
+};
+
+// The public inputs of the withdraw circuit, in circuit order.
+struct withdraw_inputs
+{
+    std::array<char, 32> root_hash;
+    std::array<char, 32> nullifier_hash;
+    std::array<char, 32> recipient;
+
+    const std::array<char, 32>& operator[](int i) const
+    {
+        return i == 0 ? root_hash : i == 1 ? nullifier_hash : recipient;
+    }
+};
+
+static_assert(sizeof(withdraw_proof) == 9 * 64 + 7 * 32, "padded proof");
+static_assert(sizeof(withdraw_proof_compressed) == 16 * 32, "padded proof");
+static_assert(sizeof(withdraw_inputs) == PUBLIC * 32, "wrong input count");
+
+// The verifier's view of a withdraw_proof. The points stay where they are
+// and only the evaluations are loaded into the field.
 typedef struct
 {
-    eosio::g1_point A;
-    eosio::g1_point B;
-    eosio::g1_point C;
-    eosio::g1_point Z;
-    eosio::g1_point T1;
-    eosio::g1_point T2;
-    eosio::g1_point T3;
-    eosio::g1_point Wxi;
-    eosio::g1_point Wxiw;
-    intx::uint256 eval_a;
-    intx::uint256 eval_b;
-    intx::uint256 eval_c;
-    intx::uint256 eval_s1;
-    intx::uint256 eval_s2;
-    intx::uint256 eval_zw;
-    intx::uint256 eval_r;
+    const withdraw_proof* data;
+    Fr eval_a;
+    Fr eval_b;
+    Fr eval_c;
+    Fr eval_s1;
+    Fr eval_s2;
+    Fr eval_zw;
+    Fr eval_r;
 } proof_t;
 
 typedef struct
@@ -52,16 +113,26 @@ typedef struct
     eosio::name recipient;
 } public_inputs_t;
 
-const eosio::g1_point
-make_g1_point(const intx::uint256& x, const intx::uint256& y);
-const eosio::g2_point
-make_g2_point(const intx::uint256& x1,
-              const intx::uint256& x2,
-              const intx::uint256& y1,
-              const intx::uint256& y2);
-eosio::g1_point
-parse_g1_point(const std::vector<char>& data, uint32_t idx);
+// Fails if a point does not decompress. The result is then loaded with
+// load_proof as any other proof.
+bool
+decompress_proof(const withdraw_proof_compressed& data, withdraw_proof& proof);
+
+withdraw_proof_compressed
+compress_proof(const withdraw_proof& proof);
+
+// Fails if an evaluation is not below q or a point is not on the curve.
+// The transcript hashes the evaluations as sent, so they must have a single
+// encoding.
+bool
+load_proof(const withdraw_proof& data, proof_t& proof);
+
+bool
+isValidProof(const proof_t& proof, const withdraw_inputs& public_inputs);
 
+// Verifies all proofs with a single pairing check. Fails if any proof is
+// invalid, without telling which.
 bool
-isValidProof(const proof_t& proof,
-             std::vector<std::vector<char>>& public_inputs);
\ No newline at end of file
+isValidProofBatch(const proof_t* proofs,
+                  const withdraw_inputs* const* public_inputs,
+                  size_t count);
\ No newline at end of file
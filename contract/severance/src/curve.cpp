@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.hpp>
+#include <curve.hpp>
+#include <eosio/eosio.hpp>
+#include <profile.hpp>
+
+using namespace intx;
+using namespace eosio;
+
+void
+g1_mul(const char* p, const Fr& s, char* result)
+{
+    uint8_t _s[32];
+    s.store(_s);
+
+    PROFILE_COUNT(alt_bn128_mul);
+    check(eosio::alt_bn128_mul(p, 64, (const char*)_s, 32, result, 64) == 0,
+          "alt_bn128_mul error");
+}
+
+void
+g1_add(const char* a, const char* b, char* result)
+{
+    PROFILE_COUNT(alt_bn128_add);
+    check(eosio::alt_bn128_add(a, 64, b, 64, result, 64) == 0,
+          "alt_bn128_add error");
+}
+
+// y^2 = x^3 + b
+constexpr Fq curve_b = Fq::from_uint256(3);
+
+bool
+g1_on_curve(const char* p)
+{
+    const uint256 x = be::unsafe::load<uint256>((const uint8_t*)p);
+    const uint256 y = be::unsafe::load<uint256>((const uint8_t*)p + 32);
+    if (x == 0 && y == 0) {
+        return true;
+    }
+    if (x >= qf || y >= qf) {
+        return false;
+    }
+
+    const Fq fx = Fq::from_uint256(x);
+    return Fq::from_uint256(y).square() == fx.square() * fx + curve_b;
+}
+
+bool
+g2_in_range(const char* p)
+{
+    for (int i = 0; i < 128; i += 32) {
+        if (be::unsafe::load<uint256>((const uint8_t*)p + i) >= qf) {
+            return false;
+        }
+    }
+    return true;
+}
+
+g1_compressed_t
+g1_compress(const char* p)
+{
+    g1_compressed_t r;
+    memcpy(r.data(), p, 32);
+
+    const uint256 y = be::unsafe::load<uint256>((const uint8_t*)p + 32);
+    if (y == 0) {
+        // The only point with y = 0, the curve has none of order two.
+        r.fill(0);
+        r[0] = G1_COMPRESSED_INFINITY;
+    } else if (y[0] & 1) {
+        r[0] |= G1_COMPRESSED_ODD;
+    }
+    return r;
+}
+
+bool
+g1_decompress(const g1_compressed_t& data, char* result)
+{
+    const uint8_t flags =
+      data[0] & (G1_COMPRESSED_ODD | G1_COMPRESSED_INFINITY);
+
+    memcpy(result, data.data(), 32);
+    result[0] &= ~flags;
+    const uint256 x = be::unsafe::load<uint256>((uint8_t*)result);
+
+    if (flags & G1_COMPRESSED_INFINITY) {
+        memset(result, 0, 64);
+        return flags == G1_COMPRESSED_INFINITY && x == 0;
+    }
+    if (x >= qf) {
+        return false;
+    }
+
+    const Fq fx = Fq::from_uint256(x);
+    Fq y;
+    if (!(fx.square() * fx + curve_b).sqrt(y)) {
+        return false;
+    }
+
+    uint256 _y = y.to_uint256();
+    if ((_y[0] & 1) != ((flags & G1_COMPRESSED_ODD) != 0)) {
+        _y = qf - _y;
+    }
+    be::unsafe::store((uint8_t*)result + 32, _y);
+    return true;
+}
+
+constexpr g2_data_t G2_data = make_g2_data(G2x1, G2x2, G2y1, G2y2);
+
+bool
+pairing_check(const char* a1, const g2_data_t& x2_neg, const char* b1)
+{
+    char pairs[2 * 192];
+    memcpy(pairs, a1, 64);
+    memcpy(pairs + 64, x2_neg.data(), 128);
+    memcpy(pairs + 192, b1, 64);
+    memcpy(pairs + 256, G2_data.data(), 128);
+
+    PROFILE_COUNT(alt_bn128_pair);
+    return eosio::alt_bn128_pair(pairs, sizeof(pairs)) == 0;
+}
+
+bool
+load_canonical(const std::array<char, 32>& data, Fr& x)
+{
+    const uint256 v = be::unsafe::load<uint256>((uint8_t*)data.data());
+    if (v >= q) {
+        return false;
+    }
+    x = Fr::from_uint256(v);
+    return true;
+}
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// FFLONK (https://eprint.iacr.org/2021/1167) as implemented by snarkjs.
+//
+// The prover commits to three combined polynomials:
+//   C0(X) = QL(X^8) + X QR(X^8) + X^2 QO(X^8) + X^3 QM(X^8) + X^4 QC(X^8)
+//           + X^5 S1(X^8) + X^6 S2(X^8) + X^7 S3(X^8)       (in the key)
+//   C1(X) = A(X^4) + X B(X^4) + X^2 C(X^4) + X^3 T0(X^4)
+//   C2(X) = Z(X^3) + X T1(X^3) + X^2 T2(X^3)
+// C0 is opened at the 8th roots of xi (S0), C1 at the 4th roots (S1) and
+// C2 at the cube roots of xi and of xi w (S2). The opening values are
+// recomputed from the evaluations, interpolated at a challenge y into
+// r0, r1, r2, and all three openings are checked with a single pairing:
+//   e(-W2, X2) * e(F - E - J + y W2, G2) == 1
+// with
+//   F = C0 + q1 C1 + q2 C2,  E = (r0 + q1 r1 + q2 r2) G1,  J = Z_S0(y) W1
+//   q1 = alpha Z_S0(y) / Z_S1(y),  q2 = alpha^2 Z_S0(y) / Z_S2(y)
+
+#include <constants.hpp>
+#include <curve.hpp>
+#include <domain.hpp>
+#include <eosio/eosio.hpp>
+#include <fflonk_verifier.hpp>
+#include <field.hpp>
+#include <profile.hpp>
+#include <transcript.hpp>
+
+using namespace intx;
+using namespace eosio;
+
+typedef field::accumulator<field::fr_params> fr_acc;
+
+// Generated by vk_gen, with X2 negated.
+#include <fflonk_verification_key.hpp>
+
+static_assert(VK_PUBLIC == PUBLIC,
+              "the key is for another number of public inputs");
+
+typedef domain<PUBLIC, POWER, w1> fflonk_domain;
+
+constexpr g1_data_t G1_data = make_g1_data(1, 2);
+
+typedef struct
+{
+    Fr ql;
+    Fr qr;
+    Fr qm;
+    Fr qo;
+    Fr qc;
+    Fr s1;
+    Fr s2;
+    Fr s3;
+    Fr a;
+    Fr b;
+    Fr c;
+    Fr z;
+    Fr zw;
+    Fr t1w;
+    Fr t2w;
+} evaluations_t;
+
+typedef struct
+{
+    Fr beta;
+    Fr gamma;
+    Fr xi_seed;
+    Fr alpha;
+    Fr y;
+
+    // xi = xi_seed^24, and the opening points, the roots of xi and xi w.
+    Fr xi;
+    Fr h0w8[8];
+    Fr h1w4[4];
+    Fr h2w3[3];
+    Fr h3w3[3];
+
+    Fr zh;
+} challenges_t;
+
+static bool
+load_evaluations(const fflonk_proof& proof, evaluations_t& ev)
+{
+    return load_canonical(proof.eval_ql, ev.ql) &&
+           load_canonical(proof.eval_qr, ev.qr) &&
+           load_canonical(proof.eval_qm, ev.qm) &&
+           load_canonical(proof.eval_qo, ev.qo) &&
+           load_canonical(proof.eval_qc, ev.qc) &&
+           load_canonical(proof.eval_s1, ev.s1) &&
+           load_canonical(proof.eval_s2, ev.s2) &&
+           load_canonical(proof.eval_s3, ev.s3) &&
+           load_canonical(proof.eval_a, ev.a) &&
+           load_canonical(proof.eval_b, ev.b) &&
+           load_canonical(proof.eval_c, ev.c) &&
+           load_canonical(proof.eval_z, ev.z) &&
+           load_canonical(proof.eval_zw, ev.zw) &&
+           load_canonical(proof.eval_t1w, ev.t1w) &&
+           load_canonical(proof.eval_t2w, ev.t2w);
+}
+
+bool
+isWellFormedFflonkProof(const fflonk_proof& proof)
+{
+    evaluations_t ev;
+    return g1_on_curve(proof.C1.data()) && g1_on_curve(proof.C2.data()) &&
+           g1_on_curve(proof.W1.data()) && g1_on_curve(proof.W2.data()) &&
+           load_evaluations(proof, ev);
+}
+
+// The largest round is alpha's: xi_seed and fifteen evaluations.
+typedef transcript<16 * 32> fflonk_transcript;
+
+static void
+calculate_challenges(const fflonk_proof& proof,
+                     const withdraw_inputs& public_inputs,
+                     challenges_t& ch)
+{
+    fflonk_transcript t;
+
+    t.absorb(C0);
+    t.absorb((const char*)&public_inputs, sizeof(public_inputs));
+    t.absorb(proof.C1);
+    ch.beta = t.squeeze();
+
+    t.absorb(ch.beta);
+    ch.gamma = t.squeeze();
+
+    t.absorb(ch.gamma);
+    t.absorb(proof.C2);
+    ch.xi_seed = t.squeeze();
+
+    // Every evaluation but eval_inv, which are adjacent in the proof.
+    t.absorb(ch.xi_seed);
+    t.absorb(proof.eval_ql.data(), 15 * 32);
+    ch.alpha = t.squeeze();
+
+    t.absorb(ch.alpha);
+    t.absorb(proof.W1);
+    ch.y = t.squeeze();
+}
+
+static void
+calculate_roots(challenges_t& ch)
+{
+    const Fr xi_seed2 = ch.xi_seed.square();
+    ch.h0w8[0] = xi_seed2 * ch.xi_seed;
+    ch.h1w4[0] = ch.h0w8[0].square();
+    ch.h2w3[0] = ch.h1w4[0] * xi_seed2;
+    ch.h3w3[0] = ch.h2w3[0] * wr;
+    for (int i = 1; i < 8; ++i) {
+        ch.h0w8[i] = ch.h0w8[i - 1] * w8;
+    }
+    for (int i = 1; i < 4; ++i) {
+        ch.h1w4[i] = ch.h1w4[i - 1] * w4;
+    }
+    for (int i = 1; i < 3; ++i) {
+        ch.h2w3[i] = ch.h2w3[i - 1] * w3;
+        ch.h3w3[i] = ch.h3w3[i - 1] * w3;
+    }
+
+    ch.xi = ch.h2w3[0].square() * ch.h2w3[0];
+
+    ch.zh = fflonk_domain::pow_n(ch.xi) - Fr::one();
+}
+
+// Horner evaluation of c[0] + c[1] h + ... + c[count - 1] h^(count - 1).
+static Fr
+combine(const Fr* c, int count, const Fr& h)
+{
+    Fr r = c[count - 1];
+    for (int i = count - 2; i >= 0; --i) {
+        r = r * h + c[i];
+    }
+    return r;
+}
+
+// Everything that is divided by, inverted with a single field inversion.
+enum
+{
+    INV_ZH,
+    INV_L,
+    INV_S0 = INV_L + PUBLIC,
+    INV_S1 = INV_S0 + 8,
+    INV_S2 = INV_S1 + 4,
+    INV_S3 = INV_S2 + 3,
+    INV_N0 = INV_S3 + 3,
+    INV_N1,
+    INV_N2,
+    INV_N3,
+    INV_ZS1,
+    INV_ZS2,
+    INV_COUNT
+};
+
+bool
+isValidFflonkProof(const fflonk_proof& proof,
+                   const withdraw_inputs& public_inputs)
+{
+    evaluations_t ev;
+    if (!load_evaluations(proof, ev)) {
+        return false;
+    }
+
+    challenges_t ch;
+    {
+        PROFILE_STAGE(STAGE_CHALLENGES);
+        calculate_challenges(proof, public_inputs, ch);
+    }
+
+    PROFILE_STAGE(STAGE_LAGRANGE);
+    calculate_roots(ch);
+
+    const Fr& w = w1;
+    const Fr& xi = ch.xi;
+    const Fr& y = ch.y;
+
+    // The vanishing polynomials of S0, S1 and S2 at y.
+    const Fr y2 = y.square();
+    const Fr y3 = y2 * y;
+    const Fr y4 = y2.square();
+    const Fr zs0 = y4.square() - xi;
+    const Fr zs1 = y4 - xi;
+    const Fr zs2 = (y3 - xi) * (y3 - xi * w);
+
+    // The Lagrange basis of a set S of roots h at y is
+    //   L_h(y) = Z_S(y) / (Z_S'(h) (y - h)) = h Z_S(y) / (N (y - h))
+    // with N = 8 xi on S0, 4 xi on S1, 3 xi^2 (1 - w) on the roots of xi in
+    // S2 and 3 xi^2 w (w - 1) on the roots of xi w.
+    Fr den[INV_COUNT];
+    Fr scratch[INV_COUNT];
+    den[INV_ZH] = ch.zh;
+    fflonk_domain::lagrange_denominators(xi, &den[INV_L]);
+    for (int i = 0; i < 8; ++i) {
+        den[INV_S0 + i] = y - ch.h0w8[i];
+    }
+    for (int i = 0; i < 4; ++i) {
+        den[INV_S1 + i] = y - ch.h1w4[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        den[INV_S2 + i] = y - ch.h2w3[i];
+        den[INV_S3 + i] = y - ch.h3w3[i];
+    }
+    const Fr xi2_3 = Fr::from_uint256(3) * xi.square();
+    den[INV_N0] = Fr::from_uint256(8) * xi;
+    den[INV_N1] = Fr::from_uint256(4) * xi;
+    den[INV_N2] = xi2_3 * (Fr::one() - w);
+    den[INV_N3] = xi2_3 * w * (w - Fr::one());
+    den[INV_ZS1] = zs1;
+    den[INV_ZS2] = zs2;
+
+    if (!field::batch_inverse(den, INV_COUNT, scratch)) {
+        return false;
+    }
+    const Fr& zh_inv = den[INV_ZH];
+
+    PROFILE_NEXT(STAGE_SCALARS);
+
+    // L_i(xi) = w^i zh / (n (xi - w^i)), PI(xi) = -sum L_i(xi) input_i
+    Fr L[PUBLIC];
+    fflonk_domain::lagrange(ch.zh, &den[INV_L], L);
+    fr_acc pi;
+    for (int i = 0; i < PUBLIC; ++i) {
+        pi.mac(Fr::load((const uint8_t*)public_inputs[i].data()), L[i]);
+    }
+
+    // T0, T1 and T2 at xi from the gate and permutation identities.
+    const Fr t0 = fr_acc()
+                    .mac(ev.ql, ev.a)
+                    .mac(ev.qr, ev.b)
+                    .mac(ev.qm * ev.a, ev.b)
+                    .mac(ev.qo, ev.c)
+                    .add(ev.qc)
+                    .add(-pi.reduce())
+                    .reduce() *
+                  zh_inv;
+
+    const Fr t1 = (ev.z - Fr::one()) * L[0] * zh_inv;
+
+    const Fr beta_xi = ch.beta * xi;
+    const Fr t2 =
+      fr_acc()
+        .mac((ev.a + beta_xi + ch.gamma) *
+               (ev.b + beta_xi * k1 + ch.gamma) *
+               (ev.c + beta_xi * k2 + ch.gamma),
+             ev.z)
+        .mac(-((ev.a + ch.beta * ev.s1 + ch.gamma) *
+               (ev.b + ch.beta * ev.s2 + ch.gamma) *
+               (ev.c + ch.beta * ev.s3 + ch.gamma)),
+             ev.zw)
+        .reduce() *
+      zh_inv;
+
+    // r_i(y) = Z_S(y) / N * sum h C_i(h) / (y - h)
+    const Fr c0[8] = { ev.ql, ev.qr, ev.qo, ev.qm, ev.qc, ev.s1, ev.s2, ev.s3 };
+    fr_acc s0;
+    for (int i = 0; i < 8; ++i) {
+        const Fr& h = ch.h0w8[i];
+        s0.mac(h * combine(c0, 8, h), den[INV_S0 + i]);
+    }
+    const Fr r0 = zs0 * den[INV_N0] * s0.reduce();
+
+    const Fr c1[4] = { ev.a, ev.b, ev.c, t0 };
+    fr_acc s1;
+    for (int i = 0; i < 4; ++i) {
+        const Fr& h = ch.h1w4[i];
+        s1.mac(h * combine(c1, 4, h), den[INV_S1 + i]);
+    }
+    const Fr r1 = zs1 * den[INV_N1] * s1.reduce();
+
+    const Fr c2[3] = { ev.z, t1, t2 };
+    const Fr c3[3] = { ev.zw, ev.t1w, ev.t2w };
+    fr_acc s2;
+    fr_acc s3;
+    for (int i = 0; i < 3; ++i) {
+        const Fr& h2 = ch.h2w3[i];
+        const Fr& h3 = ch.h3w3[i];
+        s2.mac(h2 * combine(c2, 3, h2), den[INV_S2 + i]);
+        s3.mac(h3 * combine(c3, 3, h3), den[INV_S3 + i]);
+    }
+    const Fr r2 = zs2 * fr_acc()
+                          .mac(den[INV_N2], s2.reduce())
+                          .mac(den[INV_N3], s3.reduce())
+                          .reduce();
+
+    const Fr q1 = ch.alpha * zs0 * den[INV_ZS1];
+    const Fr q2 = ch.alpha.square() * zs0 * den[INV_ZS2];
+    const Fr e = fr_acc().add(r0).mac(q1, r1).mac(q2, r2).reduce();
+
+    PROFILE_NEXT(STAGE_MSM);
+
+    // F - E - J + y W2
+    g1_sum B1;
+    B1.add(C0.data(), Fr::one());
+    B1.add(proof.C1.data(), q1);
+    B1.add(proof.C2.data(), q2);
+    B1.add(G1_data.data(), -e);
+    B1.add(proof.W1.data(), -zs0);
+    B1.add(proof.W2.data(), y);
+
+    PROFILE_NEXT(STAGE_PAIRING);
+    return pairing_check(proof.W2.data(), X2_neg, B1.get());
+}
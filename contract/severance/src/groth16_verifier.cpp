@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Groth16 (https://eprint.iacr.org/2016/260) as implemented by snarkjs:
+//   e(A, B) == e(alpha, beta) * e(L, gamma) * e(C, delta)
+// with L = IC[0] + sum input_i IC[i + 1], checked as
+//   e(A, B) * e(alpha, -beta) * e(L, -gamma) * e(C, -delta) == 1
+// beta, gamma and delta are negated in the key, so proofs need no point
+// negations. e(alpha, beta) is constant, but the host functions have no
+// arithmetic in the target group to keep it in, so all four pairs go to
+// one pairing call.
+
+#include <constants.hpp>
+#include <cstring>
+#include <curve.hpp>
+#include <eosio/eosio.hpp>
+#include <groth16_verifier.hpp>
+#include <profile.hpp>
+
+using namespace intx;
+using namespace eosio;
+
+// Generated by vk_gen, with beta2, gamma2 and delta2 negated.
+#include <groth16_verification_key.hpp>
+
+static_assert(VK_PUBLIC == PUBLIC && sizeof(IC) / sizeof(IC[0]) == PUBLIC + 1,
+              "the key is for another number of public inputs");
+
+bool
+isWellFormedGroth16Proof(const groth16_proof& proof)
+{
+    return g1_on_curve(proof.A.data()) && g2_in_range(proof.B.data()) &&
+           g1_on_curve(proof.C.data());
+}
+
+bool
+isValidGroth16Proof(const groth16_proof& proof,
+                    const withdraw_inputs& public_inputs)
+{
+    PROFILE_STAGE(STAGE_MSM);
+    g1_sum L;
+    L.add(IC[0].data(), Fr::one());
+    for (int i = 0; i < PUBLIC; ++i) {
+        Fr input;
+        if (!load_canonical(public_inputs[i], input)) {
+            return false;
+        }
+        L.add(IC[i + 1].data(), input);
+    }
+
+    PROFILE_NEXT(STAGE_PAIRING);
+    PROFILE_COUNT(alt_bn128_pair);
+    char pairs[4 * 192];
+    memcpy(pairs, proof.A.data(), 64);
+    memcpy(pairs + 64, proof.B.data(), 128);
+    memcpy(pairs + 192, alpha1.data(), 64);
+    memcpy(pairs + 256, beta2_neg.data(), 128);
+    memcpy(pairs + 384, L.get(), 64);
+    memcpy(pairs + 448, gamma2_neg.data(), 128);
+    memcpy(pairs + 576, proof.C.data(), 64);
+    memcpy(pairs + 640, delta2_neg.data(), 128);
+
+    return eosio::alt_bn128_pair(pairs, sizeof(pairs)) == 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 Harry Kalogirou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <profile.hpp>
+
+#if defined(SEVERANCE_PROFILE)
+
+#include <eosio/eosio.hpp>
+
+#if !defined(__wasm__)
+#include <chrono>
+#endif
+
+namespace profile {
+
+counters_t counters[STAGE_COUNT];
+stage_t current = STAGE_OTHER;
+static uint64_t last_switch = 0;
+
+static const char* const stage_names[STAGE_COUNT] = {
+    "other", "challenges", "lagrange", "scalars", "msm", "pairing",
+};
+
+void
+count_field_mul()
+{
+    counters[current].field_mul++;
+}
+
+void
+count_field_inv()
+{
+    counters[current].field_inv++;
+}
+
+static uint64_t
+now_ns()
+{
+#if defined(__wasm__)
+    return 0;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+void
+switch_to(stage_t stage)
+{
+    const uint64_t now = now_ns();
+    counters[current].ns += now - last_switch;
+    last_switch = now;
+    current = stage;
+}
+
+void
+reset()
+{
+    for (auto& c : counters) {
+        c = counters_t{};
+    }
+    current = STAGE_OTHER;
+    last_switch = now_ns();
+}
+
+std::vector<stage_report>
+report()
+{
+    std::vector<stage_report> r;
+    for (int i = 0; i < STAGE_COUNT; ++i) {
+        const counters_t& c = counters[i];
+        if (c.field_mul == 0 && c.field_inv == 0 && c.alt_bn128_add == 0 &&
+            c.alt_bn128_mul == 0 && c.alt_bn128_pair == 0 && c.keccak == 0 &&
+            c.ns == 0) {
+            continue;
+        }
+        r.push_back(stage_report{ stage_names[i],
+                                  c.field_mul,
+                                  c.field_inv,
+                                  c.alt_bn128_add,
+                                  c.alt_bn128_mul,
+                                  c.alt_bn128_pair,
+                                  c.keccak,
+                                  c.ns });
+    }
+    return r;
+}
+
+void
+print_report()
+{
+    for (const auto& s : report()) {
+        eosio::print(s.stage,
+                     ": mul ",
+                     s.field_mul,
+                     " inv ",
+                     s.field_inv,
+                     " add ",
+                     s.alt_bn128_add,
+                     " g1mul ",
+                     s.alt_bn128_mul,
+                     " pair ",
+                     s.alt_bn128_pair,
+                     " keccak ",
+                     s.keccak,
+                     " ns ",
+                     s.ns,
+                     "\n");
+    }
+}
+
+} // namespace profile
+
+#endif
@@ -28,6 +28,8 @@
 #include <eosio/crypto.hpp>
 #include <eosio/crypto_ext.hpp>
 #include <eosio/system.hpp>
+#include <field.hpp>
+#include <merkle.hpp>
 #include <mimcsponge.hpp>
 #include <severance.hpp>
 #include <utils.hpp>
@@ -35,8 +37,8 @@
 
 using namespace intx;
 
-const symbol PEOS_TOKEN = symbol("PEOS", 4);
-const name CONTRACT_SCOPE = "main"_n;
+constexpr symbol PEOS_TOKEN = symbol("PEOS", 4);
+constexpr name CONTRACT_SCOPE = "main"_n;
 
 typedef struct
 {
@@ -47,27 +49,34 @@ typedef struct
     uint64_t quantity_step;
 } token_info_t;
 
-const token_info_t supported_tokens[] = { { .symbol = PEOS_TOKEN,
-                                            .contract = "thepeostoken"_n,
-                                            .quantity_min = 1000,
-                                            .quantity_max = 1000000000,
-                                            .quantity_step = 10 },
-                                          { .symbol = symbol("EOS", 4),
-                                            .contract = "eosio.token"_n,
-                                            .quantity_min = 100000,
-                                            .quantity_max = 10000000000,
-                                            .quantity_step = 10 } };
-
-static const token_info_t&
-get_token_info(const symbol& symbol)
+constexpr token_info_t supported_tokens[] = { { .symbol = PEOS_TOKEN,
+                                                .contract = "thepeostoken"_n,
+                                                .quantity_min = 1000,
+                                                .quantity_max = 1000000000,
+                                                .quantity_step = 10 },
+                                              { .symbol = symbol("EOS", 4),
+                                                .contract = "eosio.token"_n,
+                                                .quantity_min = 100000,
+                                                .quantity_max = 10000000000,
+                                                .quantity_step = 10 } };
+
+static const token_info_t*
+find_token_info(const symbol& symbol)
 {
     for (const auto& token : supported_tokens) {
         if (token.symbol == symbol) {
-            return token;
+            return &token;
         }
     }
-    check(false, "Unsupported token");
-    __builtin_unreachable();
+    return nullptr;
+}
+
+static const token_info_t&
+get_token_info(const symbol& symbol)
+{
+    const token_info_t* token = find_token_info(symbol);
+    check(token != nullptr, "Unsupported token");
+    return *token;
 }
 
 static int8_t
@@ -109,40 +118,16 @@ severance::calculate_fees(const severance::globalstateext* global_state_ext,
     return global_state_ext->oracle_rate * fees / 1000000;
 }
 
-static proof_t
-parse_proof(const std::vector<char>& proof_data)
-{
-    const uint8_t* proof_data_ptr = (const uint8_t*)proof_data.data();
-    return proof_t{
-        .A = parse_g1_point(proof_data, 0),
-        .B = parse_g1_point(proof_data, 64),
-        .C = parse_g1_point(proof_data, 128),
-        .Z = parse_g1_point(proof_data, 192),
-        .T1 = parse_g1_point(proof_data, 256),
-        .T2 = parse_g1_point(proof_data, 320),
-        .T3 = parse_g1_point(proof_data, 384),
-        .Wxi = parse_g1_point(proof_data, 448),
-        .Wxiw = parse_g1_point(proof_data, 512),
-        .eval_a = be::unsafe::load<uint256>(proof_data_ptr + 576),
-        .eval_b = be::unsafe::load<uint256>(proof_data_ptr + 608),
-        .eval_c = be::unsafe::load<uint256>(proof_data_ptr + 640),
-        .eval_s1 = be::unsafe::load<uint256>(proof_data_ptr + 672),
-        .eval_s2 = be::unsafe::load<uint256>(proof_data_ptr + 704),
-        .eval_zw = be::unsafe::load<uint256>(proof_data_ptr + 736),
-        .eval_r = be::unsafe::load<uint256>(proof_data_ptr + 768),
-    };
-}
-
 static public_inputs_t
-parse_public_inputs(const std::vector<std::vector<char>>& public_inputs)
+parse_public_inputs(const withdraw_inputs& public_inputs)
 {
-    checksum256 nullifier_hash;
-    unpack(nullifier_hash, public_inputs[1].data(), public_inputs[1].size());
     return public_inputs_t{
-        .root_hash = be::unsafe::load<uint256>((uint8_t*)&public_inputs[0]),
-        .nullifier_hash = nullifier_hash,
-        .recipient = name{ (uint64_t)be::unsafe::load<uint256>(
-          (uint8_t*)&public_inputs[2][0]) },
+      .root_hash =
+        be::unsafe::load<uint256>((uint8_t*)public_inputs.root_hash.data()),
+      .nullifier_hash =
+        unpack<checksum256>(public_inputs.nullifier_hash.data(), 32),
+      .recipient = name{ (uint64_t)be::unsafe::load<uint256>(
+        (uint8_t*)public_inputs.recipient.data()) },
     };
 }
 
@@ -239,40 +224,22 @@ severance::deposit(name owner,
         row.hash = commitment_hash;
     });
 
-    uint256 commitment =
-      be::unsafe::load<uint256>((uint8_t*)commitment_data.data());
-
-    uint256 left, right;
-    uint256 current_hash = commitment;
-    uint32_t current_index = global_state->next_leaf_index;
-    uint8_t hash_directions[MERKLE_HEIGHT];
-    uint256 hash_pairs[MERKLE_HEIGHT];
-
-    for (int i = 0; i < MERKLE_HEIGHT; i++) {
-
-        if (current_index % 2 == 0) {
-            left = current_hash;
-            right = level_defaults[i];
-            hash_pairs[i] = right;
-            hash_directions[i] = 0;
-        } else {
-            left = get_last_level_hash(quantity_scope, i);
-            right = current_hash;
-            hash_pairs[i] = left;
-            hash_directions[i] = 1;
-        }
-
-        set_last_level_hash(quantity_scope, i, current_hash);
-
-        current_hash = MiMC5Sponge::MiMC5Sponge(left, right, commitment);
-        current_index /= 2;
-    }
+    const Fr commitment = Fr::load((uint8_t*)commitment_data.data());
+    const Fr current_hash = merkle_insert(
+      commitment,
+      global_state->next_leaf_index,
+      [&](int level) {
+          return Fr::from_uint256(get_last_level_hash(quantity_scope, level));
+      },
+      [&](int level, const Fr& hash) {
+          set_last_level_hash(quantity_scope, level, hash.to_uint256());
+      });
 
     roothash_t roothashes_table(get_self(), quantity_scope);
     roothashes_table.emplace(owner, [&](auto& row) {
         row.id = roothashes_table.available_primary_key();
         le::unsafe::store<uint256>((uint8_t*)row.root_hash.data(),
-                                   current_hash);
+                                   current_hash.to_uint256());
         uint128_t t = *(uint128_t*)row.root_hash.data();
         *(uint128_t*)row.root_hash.data() =
           *(uint128_t*)(row.root_hash.data() + 1);
@@ -289,9 +256,212 @@ severance::deposit(name owner,
     set_global_fee(global_fee);
 }
 
+static const char* const withdraw_stage_names[] = {
+    "args",
+    "encoding",
+    "state",
+    "proof",
+};
+
+// The message is built only on failure.
+void
+severance::require(const check_result& result)
+{
+    if (result.failed()) {
+        check(false,
+              std::string(withdraw_stage_names[result.stage]) + ": " +
+                result.error);
+    }
+}
+
+severance::withdraw_check
+severance::to_withdraw_check(const check_result& result)
+{
+    if (result.failed()) {
+        return { .valid = false, .stage = result.stage, .error = result.error };
+    }
+    return { .valid = true, .stage = WITHDRAW_OK, .error = "" };
+}
+
+// Only in memory; the pool's proof system is checked after the inputs, see
+// check_withdraw_verifier.
+severance::check_result
+severance::check_withdraw_args(const asset& quantity, uint64_t& scope)
+{
+    if (find_token_info(quantity.symbol) == nullptr) {
+        return { WITHDRAW_ARGS, "Unsupported token" };
+    }
+    if (!quantity.is_valid()) {
+        return { WITHDRAW_ARGS, "invalid quantity" };
+    }
+    if (quantity.amount <= 0) {
+        return { WITHDRAW_ARGS, "bad amount" };
+    }
+
+    scope = get_quantity_scope(quantity);
+    return {};
+}
+
+// Public inputs must be below q. The verifiers take them modulo q, so x and
+// x + q would otherwise both be accepted, and give two nullifier hashes for
+// one note.
+severance::check_result
+severance::check_withdraw_inputs(const withdraw_inputs& public_inputs,
+                                 name to,
+                                 const std::string& memo,
+                                 public_inputs_t& inputs)
+{
+    if (memo.size() >= 256) {
+        return { WITHDRAW_ARGS, "memo size too big" };
+    }
+
+    inputs = parse_public_inputs(public_inputs);
+    if (inputs.recipient != to) {
+        return { WITHDRAW_ARGS, "wrong recipient" };
+    }
+
+    for (int i = 0; i < PUBLIC; ++i) {
+        if (be::unsafe::load<uint256>((uint8_t*)public_inputs[i].data()) >= q) {
+            return { WITHDRAW_ENCODING, "invalid public input" };
+        }
+    }
+    return {};
+}
+
+// The last argument check, as the only one that reads a table.
+severance::check_result
+severance::check_withdraw_verifier(uint64_t scope, uint8_t verifier)
+{
+    if (get_verifier(scope) != verifier) {
+        return { WITHDRAW_ARGS, "pool takes another proof system" };
+    }
+    return {};
+}
+
+// The argument checks of a single withdrawal, in their order.
+severance::check_result
+severance::check_withdraw_request(const asset& quantity,
+                                  uint8_t verifier,
+                                  const withdraw_inputs& public_inputs,
+                                  name to,
+                                  const std::string& memo,
+                                  uint64_t& scope,
+                                  public_inputs_t& inputs)
+{
+    check_result result = check_withdraw_args(quantity, scope);
+    if (!result.failed()) {
+        result = check_withdraw_inputs(public_inputs, to, memo, inputs);
+    }
+    if (!result.failed()) {
+        result = check_withdraw_verifier(scope, verifier);
+    }
+    return result;
+}
+
+severance::check_result
+severance::check_withdraw_state(uint64_t scope,
+                                const std::array<char, 32>& root_data,
+                                const checksum256& nullifier_hash)
+{
+    roothash_t roothashes_table(get_self(), scope);
+    auto roothashes_idx = roothashes_table.get_index<"hash"_n>();
+    const auto root_hash = unpack<checksum256>(root_data.data(), 32);
+    if (roothashes_idx.find(root_hash) == roothashes_idx.end()) {
+        return { WITHDRAW_STATE, "root hash not found" };
+    }
+
+    nullifier_t nullifiers_table(get_self(), scope);
+    auto nullifiers_idx = nullifiers_table.get_index<"hash"_n>();
+    if (nullifiers_idx.find(nullifier_hash) != nullifiers_idx.end()) {
+        return { WITHDRAW_STATE, "already cashed out" };
+    }
+    return {};
+}
+
+severance::check_result
+severance::check_plonk_withdrawal(uint64_t scope,
+                                  const withdraw_proof& proof_data,
+                                  const withdraw_inputs& public_inputs,
+                                  const public_inputs_t& inputs)
+{
+    proof_t proof;
+    if (!load_proof(proof_data, proof)) {
+        return { WITHDRAW_ENCODING, "invalid proof" };
+    }
+
+    const check_result state = check_withdraw_state(
+      scope, public_inputs.root_hash, inputs.nullifier_hash);
+    if (state.failed()) {
+        return state;
+    }
+
+    if (!isValidProof(proof, public_inputs)) {
+        return { WITHDRAW_PROOF, "Invalid proof" };
+    }
+    return {};
+}
+
+severance::check_result
+severance::check_compressed_withdrawal(
+  uint64_t scope,
+  const withdraw_proof_compressed& proof_data,
+  const withdraw_inputs& public_inputs,
+  const public_inputs_t& inputs)
+{
+    withdraw_proof proof;
+    if (!decompress_proof(proof_data, proof)) {
+        return { WITHDRAW_ENCODING, "invalid proof" };
+    }
+    return check_plonk_withdrawal(scope, proof, public_inputs, inputs);
+}
+
+severance::check_result
+severance::check_fflonk_withdrawal(uint64_t scope,
+                                   const fflonk_proof& proof_data,
+                                   const withdraw_inputs& public_inputs,
+                                   const public_inputs_t& inputs)
+{
+    if (!isWellFormedFflonkProof(proof_data)) {
+        return { WITHDRAW_ENCODING, "invalid proof" };
+    }
+
+    const check_result state = check_withdraw_state(
+      scope, public_inputs.root_hash, inputs.nullifier_hash);
+    if (state.failed()) {
+        return state;
+    }
+
+    if (!isValidFflonkProof(proof_data, public_inputs)) {
+        return { WITHDRAW_PROOF, "Invalid proof" };
+    }
+    return {};
+}
+
+severance::check_result
+severance::check_groth16_withdrawal(uint64_t scope,
+                                    const groth16_proof& proof_data,
+                                    const withdraw_inputs& public_inputs,
+                                    const public_inputs_t& inputs)
+{
+    if (!isWellFormedGroth16Proof(proof_data)) {
+        return { WITHDRAW_ENCODING, "invalid proof" };
+    }
+
+    const check_result state = check_withdraw_state(
+      scope, public_inputs.root_hash, inputs.nullifier_hash);
+    if (state.failed()) {
+        return state;
+    }
+
+    if (!isValidGroth16Proof(proof_data, public_inputs)) {
+        return { WITHDRAW_PROOF, "Invalid proof" };
+    }
+    return {};
+}
+
 [[eosio::action]] void
-severance::withdraw(std::vector<char>& proof_data,
-                    std::vector<std::vector<char>>& public_inputs,
+severance::withdraw(withdraw_proof& proof_data,
+                    withdraw_inputs& public_inputs,
                     name owner,
                     name to,
                     eosio::asset quantity,
@@ -299,34 +469,309 @@ severance::withdraw(std::vector<char>& proof_data,
 {
     require_auth(owner);
 
-    const auto& token = get_token_info(quantity.symbol);
-    check(quantity.is_valid(), "invalid quantity");
-    check(quantity.amount > 0, "bad amount");
-    check(memo.size() < 256, "memo size too big");
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    require(check_withdraw_request(quantity,
+                                   VERIFIER_PLONK,
+                                   public_inputs,
+                                   to,
+                                   memo,
+                                   quantity_scope,
+                                   inputs));
+    require(check_plonk_withdrawal(
+      quantity_scope, proof_data, public_inputs, inputs));
+
+    cash_out(quantity_scope, owner, inputs.nullifier_hash, to, quantity, memo);
+}
 
-    const uint64_t quantity_scope = get_quantity_scope(quantity);
-    roothash_t roothashes_table(get_self(), quantity_scope);
-    auto roothashes_idx = roothashes_table.get_index<"hash"_n>();
-    checksum256 root_hash; // = public_inputs[0];
-    root_hash = unpack<checksum256>(public_inputs[0]);
+[[eosio::action]] void
+severance::withdrawc(withdraw_proof_compressed& proof_data,
+                     withdraw_inputs& public_inputs,
+                     name owner,
+                     name to,
+                     eosio::asset quantity,
+                     std::string memo)
+{
+    require_auth(owner);
+
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    require(check_withdraw_request(quantity,
+                                   VERIFIER_PLONK,
+                                   public_inputs,
+                                   to,
+                                   memo,
+                                   quantity_scope,
+                                   inputs));
+    require(check_compressed_withdrawal(
+      quantity_scope, proof_data, public_inputs, inputs));
+
+    cash_out(quantity_scope, owner, inputs.nullifier_hash, to, quantity, memo);
+}
+
+[[eosio::action, eosio::read_only]] severance::withdraw_check
+severance::checkwithdraw(withdraw_proof& proof_data,
+                         withdraw_inputs& public_inputs,
+                         name to,
+                         eosio::asset quantity,
+                         std::string memo)
+{
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    check_result result = check_withdraw_request(quantity,
+                                                 VERIFIER_PLONK,
+                                                 public_inputs,
+                                                 to,
+                                                 memo,
+                                                 quantity_scope,
+                                                 inputs);
+    if (!result.failed()) {
+        result = check_plonk_withdrawal(
+          quantity_scope, proof_data, public_inputs, inputs);
+    }
+    return to_withdraw_check(result);
+}
+
+[[eosio::action, eosio::read_only]] severance::withdraw_check
+severance::checkwithdrawc(withdraw_proof_compressed& proof_data,
+                          withdraw_inputs& public_inputs,
+                          name to,
+                          eosio::asset quantity,
+                          std::string memo)
+{
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    check_result result = check_withdraw_request(quantity,
+                                                 VERIFIER_PLONK,
+                                                 public_inputs,
+                                                 to,
+                                                 memo,
+                                                 quantity_scope,
+                                                 inputs);
+    if (!result.failed()) {
+        result = check_compressed_withdrawal(
+          quantity_scope, proof_data, public_inputs, inputs);
+    }
+    return to_withdraw_check(result);
+}
+
+[[eosio::action, eosio::read_only]] severance::withdraw_check
+severance::checkwithdrawff(fflonk_proof& proof_data,
+                           withdraw_inputs& public_inputs,
+                           name to,
+                           eosio::asset quantity,
+                           std::string memo)
+{
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    check_result result = check_withdraw_request(quantity,
+                                                 VERIFIER_FFLONK,
+                                                 public_inputs,
+                                                 to,
+                                                 memo,
+                                                 quantity_scope,
+                                                 inputs);
+    if (!result.failed()) {
+        result = check_fflonk_withdrawal(
+          quantity_scope, proof_data, public_inputs, inputs);
+    }
+    return to_withdraw_check(result);
+}
+
+[[eosio::action, eosio::read_only]] severance::withdraw_check
+severance::checkwithdrawgro(groth16_proof& proof_data,
+                            withdraw_inputs& public_inputs,
+                            name to,
+                            eosio::asset quantity,
+                            std::string memo)
+{
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    check_result result = check_withdraw_request(quantity,
+                                                 VERIFIER_GROTH16,
+                                                 public_inputs,
+                                                 to,
+                                                 memo,
+                                                 quantity_scope,
+                                                 inputs);
+    if (!result.failed()) {
+        result = check_groth16_withdrawal(
+          quantity_scope, proof_data, public_inputs, inputs);
+    }
+    return to_withdraw_check(result);
+}
+
+[[eosio::action]] void
+severance::withdrawff(fflonk_proof& proof_data,
+                      withdraw_inputs& public_inputs,
+                      name owner,
+                      name to,
+                      eosio::asset quantity,
+                      std::string memo)
+{
+    require_auth(owner);
+
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    require(check_withdraw_request(quantity,
+                                   VERIFIER_FFLONK,
+                                   public_inputs,
+                                   to,
+                                   memo,
+                                   quantity_scope,
+                                   inputs));
+    require(check_fflonk_withdrawal(
+      quantity_scope, proof_data, public_inputs, inputs));
+
+    cash_out(quantity_scope, owner, inputs.nullifier_hash, to, quantity, memo);
+}
+
+[[eosio::action]] void
+severance::withdrawgro(groth16_proof& proof_data,
+                       withdraw_inputs& public_inputs,
+                       name owner,
+                       name to,
+                       eosio::asset quantity,
+                       std::string memo)
+{
+    require_auth(owner);
+
+    uint64_t quantity_scope;
+    public_inputs_t inputs;
+    require(check_withdraw_request(quantity,
+                                   VERIFIER_GROTH16,
+                                   public_inputs,
+                                   to,
+                                   memo,
+                                   quantity_scope,
+                                   inputs));
+    require(check_groth16_withdrawal(
+      quantity_scope, proof_data, public_inputs, inputs));
+
+    cash_out(quantity_scope, owner, inputs.nullifier_hash, to, quantity, memo);
+}
 
-    check(roothashes_idx.find(root_hash) != roothashes_idx.end(),
-          "root hash not found");
+[[eosio::action]] void
+severance::withdrawbatch(std::vector<withdrawal>& withdrawals,
+                         name owner,
+                         eosio::asset quantity)
+{
+    require_auth(owner);
+
+    uint64_t quantity_scope;
+    require(check_withdraw_args(quantity, quantity_scope));
+    if (withdrawals.empty()) {
+        require({ WITHDRAW_ARGS, "no withdrawals" });
+    }
+
+    const size_t count = withdrawals.size();
+    std::vector<proof_t> proofs(count);
+    std::vector<const withdraw_inputs*> public_inputs(count);
+    std::vector<public_inputs_t> inputs(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto& w = withdrawals[i];
+        require(
+          check_withdraw_inputs(w.public_inputs, w.to, w.memo, inputs[i]));
+        public_inputs[i] = &w.public_inputs;
+    }
+    require(check_withdraw_verifier(quantity_scope, VERIFIER_PLONK));
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!load_proof(withdrawals[i].proof_data, proofs[i])) {
+            require({ WITHDRAW_ENCODING, "invalid proof" });
+        }
+    }
 
-    const auto proof = parse_proof(proof_data);
+    // A nullifier repeated within the batch is not in the table yet.
+    for (size_t i = 0; i < count; ++i) {
+        require(check_withdraw_state(quantity_scope,
+                                     withdrawals[i].public_inputs.root_hash,
+                                     inputs[i].nullifier_hash));
+        for (size_t j = 0; j < i; ++j) {
+            if (inputs[j].nullifier_hash == inputs[i].nullifier_hash) {
+                require({ WITHDRAW_STATE, "already cashed out" });
+            }
+        }
+    }
 
-    check(isValidProof(proof, public_inputs), "Invalid proof");
+    if (!isValidProofBatch(proofs.data(), public_inputs.data(), count)) {
+        require({ WITHDRAW_PROOF, "Invalid proof" });
+    }
 
-    auto inputs = parse_public_inputs(public_inputs);
-    check(inputs.recipient == to, "wrong recipient");
+    for (size_t i = 0; i < count; ++i) {
+        cash_out(quantity_scope,
+                 owner,
+                 inputs[i].nullifier_hash,
+                 withdrawals[i].to,
+                 quantity,
+                 withdrawals[i].memo);
+    }
+}
 
-    nullifier_t nullifiers_table(get_self(), quantity_scope);
-    auto idx = nullifiers_table.get_index<"hash"_n>();
-    check(idx.find(inputs.nullifier_hash) == idx.end(), "already cashed out");
+#ifdef SEVERANCE_PROFILE
+[[eosio::action]] std::vector<profile::stage_report>
+severance::verifycost(withdraw_proof& proof_data,
+                      withdraw_inputs& public_inputs)
+{
+    profile::reset();
+
+    proof_t proof;
+    check(load_proof(proof_data, proof), "Invalid proof");
+    const bool valid = isValidProof(proof, public_inputs);
+
+    profile::print_report();
+    print(valid ? "valid\n" : "invalid\n");
+    return profile::report();
+}
+#endif
+
+[[eosio::action]] void
+severance::setverifier(asset quantity, uint8_t verifier)
+{
+    require_auth(get_self());
+
+    get_token_info(quantity.symbol);
+    check(quantity.is_valid(), "invalid quantity");
+    check(verifier <= VERIFIER_GROTH16, "unknown verifier");
+
+    const uint64_t quantity_scope = get_quantity_scope(quantity);
+    pool_config_t pool_config_table(get_self(), CONTRACT_SCOPE.value);
+    auto itr = pool_config_table.find(quantity_scope);
+    if (itr == pool_config_table.end()) {
+        pool_config_table.emplace(get_self(), [&](auto& row) {
+            row.scope = quantity_scope;
+            row.verifier = verifier;
+        });
+    } else {
+        pool_config_table.modify(
+          itr, get_self(), [&](auto& row) { row.verifier = verifier; });
+    }
+}
+
+uint8_t
+severance::get_verifier(uint64_t scope)
+{
+    pool_config_t pool_config_table(get_self(), CONTRACT_SCOPE.value);
+    auto itr = pool_config_table.find(scope);
+    return itr == pool_config_table.end() ? VERIFIER_PLONK : itr->verifier;
+}
+
+void
+severance::cash_out(uint64_t scope,
+                    name owner,
+                    const checksum256& nullifier_hash,
+                    name to,
+                    const asset& quantity,
+                    const std::string& memo)
+{
+    const auto& token = get_token_info(quantity.symbol);
 
+    // The nullifier is not in the table, see check_withdraw_state.
+    nullifier_t nullifiers_table(get_self(), scope);
     nullifiers_table.emplace(owner, [&](auto& row) {
         row.id = nullifiers_table.available_primary_key();
-        row.hash = inputs.nullifier_hash;
+        row.hash = nullifier_hash;
     });
 
     action{
@@ -20,140 +20,47 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
 #include <constants.hpp>
+#include <cstring>
+#include <curve.hpp>
+#include <domain.hpp>
 #include <eosio/crypto.hpp>
 #include <eosio/crypto_ext.hpp>
+#include <field.hpp>
+#include <profile.hpp>
+#include <transcript.hpp>
 #include <verifier.hpp>
 
 using namespace intx;
 using namespace eosio;
 
-typedef struct int256_t
-{
-    uint256 value;
-    bool is_negative;
-} int256;
-
-uint256
-modinv(uint256 a, uint256 b)
-{
-    if (b <= 1)
-        return 0;
-
-    uint256 b0 = b;
-    int256 x0 = { 0, false };
-    int256 x1 = { 1, false };
-
-    while (a > 1) {
-        if (b == 0)
-            return 0;
-        auto sd = sdivrem(a, b);
-        uint256 q = sd.quot;
-        uint256 t = b;
-        b = sd.rem;
-        a = t;
-
-        int256 t2 = x0;
-        uint256 qx0 = q * x0.value;
-        if (x0.is_negative != x1.is_negative) {
-            x0.value = x1.value + qx0;
-            x0.is_negative = x1.is_negative;
-        } else {
-            x0.value = (x1.value > qx0) ? x1.value - qx0 : qx0 - x1.value;
-            x0.is_negative =
-              (x1.value > qx0) ? x1.is_negative : !x0.is_negative;
-        }
-        x1 = t2;
-    }
-
-    return x1.is_negative ? (b0 - x1.value) : x1.value;
-}
-
-const g1_point
-make_g1_point(const uint256& x, const uint256& y)
-{
-    std::vector<char> _x(32);
-    std::vector<char> _y(32);
-
-    be::unsafe::store((uint8_t*)_x.data(), x);
-    be::unsafe::store((uint8_t*)_y.data(), y);
-
-    return eosio::g1_point{ _x, _y };
-}
-
-const g2_point
-make_g2_point(const uint256& x1,
-              const uint256& x2,
-              const uint256& y1,
-              const uint256& y2)
-{
-    std::vector<char> _x(64);
-    std::vector<char> _y(64);
-
-    be::unsafe::store((uint8_t*)_x.data(), x2);
-    be::unsafe::store((uint8_t*)(_x.data() + 32), x1);
-    be::unsafe::store((uint8_t*)_y.data(), y2);
-    be::unsafe::store((uint8_t*)(_y.data() + 32), y1);
-
-    return eosio::g2_point{ _x, _y };
-}
-
-g1_point
-g1_mul(const g1_point& p, const uint256& s)
-{
-    std::vector<char> _s(32);
-    be::unsafe::store((uint8_t*)_s.data(), s);
-
-    return eosio::alt_bn128_mul(p, _s);
-}
-
-inline g1_point
-g1_add(const g1_point& a, const g1_point& b)
-{
-    return eosio::alt_bn128_add(a, b);
-}
+typedef field::accumulator<field::fr_params> fr_acc;
 
 typedef struct
 {
-    uint256 beta;
-    uint256 gamma;
-    uint256 alpha;
-    uint256 xi;
-    uint256 v[6];
-    uint256 u;
-
-    uint256 xin;
-    uint256 zh;
+    Fr beta;
+    Fr gamma;
+    Fr alpha;
+    Fr xi;
+    Fr v[6];
+    Fr u;
+
+    Fr xin;
+    Fr zh;
+    Fr zh_inv;
 } challenges_t;
 
+// Generated by vk_gen. It holds X2 negated, as the pairing check needs -A1
+// and negating X2 instead leaves no point negations in the verifier.
 #include <verification_key.hpp>
 
-const eosio::g1_point G1 = make_g1_point(1, 2);
-const eosio::g2_point G2 = make_g2_point(G2x1, G2x2, G2y1, G2y2);
+static_assert(VK_PUBLIC == PUBLIC,
+              "the key is for another number of public inputs");
 
-inline g1_point
-g1_sub(g1_point& a, g1_point& b)
-{
-    std::vector<char> _s(32);
+typedef domain<PUBLIC, POWER, w1> withdraw_domain;
 
-    uint256 _y = be::unsafe::load<uint256>((uint8_t*)b.y.data());
-    be::unsafe::store((uint8_t*)_s.data(), (qf - _y) % qf);
-
-    g1_point _b(b.x, _s);
-    return eosio::alt_bn128_add(a, _b);
-}
-
-inline g1_point
-g1_neg(g1_point& a)
-{
-    std::vector<char> _s(32);
-
-    uint256 _y = be::unsafe::load<uint256>((uint8_t*)a.y.data());
-    be::unsafe::store((uint8_t*)_s.data(), (qf - _y) % qf);
-
-    g1_point _b(a.x, _s);
-    return _b;
-}
+constexpr g1_data_t G1_data = make_g1_data(1, 2);
 
 void
 printCharArrayAsHex(const char* charArray, size_t size)
@@ -174,287 +81,426 @@ printCharArrayAsHex(const char* charArray, size_t size)
     print("\n");
 }
 
-eosio::g1_point
-parse_g1_point(const std::vector<char>& data, uint32_t idx)
-{
-    std::vector<char> x(32);
-    std::vector<char> y(32);
-    for (int i = 0; i < 32; ++i) {
-        x[i] = data[idx + i];
-        y[i] = data[idx + 32 + i];
-    }
-    return eosio::g1_point(x, y);
-}
+// The points of a proof, in the same order in both layouts.
+static std::array<char, 64> withdraw_proof::*const proof_points[] = {
+    &withdraw_proof::A,  &withdraw_proof::B,   &withdraw_proof::C,
+    &withdraw_proof::Z,  &withdraw_proof::T1,  &withdraw_proof::T2,
+    &withdraw_proof::T3, &withdraw_proof::Wxi, &withdraw_proof::Wxiw
+};
+static g1_compressed_t withdraw_proof_compressed::*const compressed_points[] =
+  { &withdraw_proof_compressed::A,   &withdraw_proof_compressed::B,
+    &withdraw_proof_compressed::C,   &withdraw_proof_compressed::Z,
+    &withdraw_proof_compressed::T1,  &withdraw_proof_compressed::T2,
+    &withdraw_proof_compressed::T3,  &withdraw_proof_compressed::Wxi,
+    &withdraw_proof_compressed::Wxiw };
 
-template<typename T>
-uint256
-hash_to_Fr(const T* data, uint32_t size)
+bool
+load_proof(const withdraw_proof& data, proof_t& proof)
 {
-    auto checksum = eosio::keccak((const char*)data, size);
-    uint256 keccak = be::unsafe::load<uint256>(
-      (const uint8_t*)checksum.extract_as_byte_array().data());
-    return keccak % q;
+    proof.data = &data;
+    for (auto point : proof_points) {
+        if (!g1_on_curve((data.*point).data())) {
+            return false;
+        }
+    }
+    return load_canonical(data.eval_a, proof.eval_a) &&
+           load_canonical(data.eval_b, proof.eval_b) &&
+           load_canonical(data.eval_c, proof.eval_c) &&
+           load_canonical(data.eval_s1, proof.eval_s1) &&
+           load_canonical(data.eval_s2, proof.eval_s2) &&
+           load_canonical(data.eval_zw, proof.eval_zw) &&
+           load_canonical(data.eval_r, proof.eval_r);
 }
 
-template<typename T>
-uint256
-hash_to_Fr(const std::vector<T>& data)
+bool
+decompress_proof(const withdraw_proof_compressed& data, withdraw_proof& proof)
 {
-    return hash_to_Fr(data.data(), data.size());
+    for (int i = 0; i < 9; ++i) {
+        if (!g1_decompress(data.*compressed_points[i],
+                           (proof.*proof_points[i]).data())) {
+            return false;
+        }
+    }
+    memcpy(&proof.eval_a, &data.eval_a, 7 * 32);
+    return true;
 }
 
-inline void
-insert_to_buffer(std::vector<uint8_t>& buffer, const eosio::g1_point& point)
+withdraw_proof_compressed
+compress_proof(const withdraw_proof& proof)
 {
-    auto p = point.serialized();
-    buffer.insert(buffer.end(), p.begin(), p.end());
+    withdraw_proof_compressed data;
+    for (int i = 0; i < 9; ++i) {
+        data.*compressed_points[i] =
+          g1_compress((proof.*proof_points[i]).data());
+    }
+    memcpy(&data.eval_a, &proof.eval_a, 7 * 32);
+    return data;
 }
 
-inline void
-insert_to_buffer(std::vector<uint8_t>& buffer, const uint256& x)
-{
-    uint8_t b[32];
-    be::store<uint256>(b, x);
-    buffer.insert(buffer.end(), b, b + 32);
-}
+// The largest round is the first: the public inputs and A, B, C.
+typedef transcript<sizeof(withdraw_inputs) + 3 * 64> withdraw_transcript;
 
 void
 calculate_challenges(const proof_t& proof,
-                     const std::vector<std::vector<char>>& public_inputs,
+                     const withdraw_inputs& public_inputs,
                      challenges_t& ch)
 {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(32 * public_inputs.size());
-    for (auto input : public_inputs) {
-        buffer.insert(buffer.end(), input.begin(), input.end());
-    }
-
-    insert_to_buffer(buffer, proof.A);
-    insert_to_buffer(buffer, proof.B);
-    insert_to_buffer(buffer, proof.C);
-    ch.beta = hash_to_Fr(buffer);
-
-    uint8_t b[32];
-    be::store<uint256>(b, ch.beta);
-    ch.gamma = hash_to_Fr(b, 32);
-    ch.alpha = hash_to_Fr(proof.Z.serialized());
-
-    buffer.clear();
-    insert_to_buffer(buffer, proof.T1);
-    insert_to_buffer(buffer, proof.T2);
-    insert_to_buffer(buffer, proof.T3);
-    ch.xi = hash_to_Fr(buffer);
-
-    buffer.clear();
-    insert_to_buffer(buffer, proof.eval_a);
-    insert_to_buffer(buffer, proof.eval_b);
-    insert_to_buffer(buffer, proof.eval_c);
-    insert_to_buffer(buffer, proof.eval_s1);
-    insert_to_buffer(buffer, proof.eval_s2);
-    insert_to_buffer(buffer, proof.eval_zw);
-    insert_to_buffer(buffer, proof.eval_r);
-    ch.v[0] = hash_to_Fr(buffer);
+    const withdraw_proof& data = *proof.data;
+    withdraw_transcript t;
+
+    t.absorb((const char*)&public_inputs, sizeof(public_inputs));
+    t.absorb(data.A);
+    t.absorb(data.B);
+    t.absorb(data.C);
+    ch.beta = t.squeeze();
+
+    t.absorb(ch.beta);
+    ch.gamma = t.squeeze();
+
+    t.absorb(data.Z);
+    ch.alpha = t.squeeze();
+
+    t.absorb(data.T1);
+    t.absorb(data.T2);
+    t.absorb(data.T3);
+    ch.xi = t.squeeze();
+
+    t.absorb(data.eval_a);
+    t.absorb(data.eval_b);
+    t.absorb(data.eval_c);
+    t.absorb(data.eval_s1);
+    t.absorb(data.eval_s2);
+    t.absorb(data.eval_zw);
+    t.absorb(data.eval_r);
+    ch.v[0] = t.squeeze();
     for (int i = 1; i < 6; ++i) {
-        ch.v[i] = mulmod(ch.v[i - 1], ch.v[0], q);
+        ch.v[i] = ch.v[i - 1] * ch.v[0];
     }
 
-    buffer.clear();
-    insert_to_buffer(buffer, proof.Wxi);
-    insert_to_buffer(buffer, proof.Wxiw);
-    ch.u = hash_to_Fr(buffer);
+    t.absorb(data.Wxi);
+    t.absorb(data.Wxiw);
+    ch.u = t.squeeze();
 }
 
-std::vector<uint256>
-calculate_lagrange_evaluations(challenges_t& ch, int public_inputs_size)
+// Computes L_i(xi) for every public input together with 1 / zh, using a
+// single field inversion for all the denominators. Fails if one of them is
+// zero, i.e. if xi falls on the evaluation domain.
+bool
+calculate_lagrange_evaluations(challenges_t& ch, Fr L[PUBLIC])
 {
-    uint256 xin = ch.xi;
-    uint32_t domain_size = 1;
-    for (int i = 0; i < POWER; ++i) {
-        domain_size *= 2;
-        xin = mulmod(xin, xin, q);
-    }
-    ch.xin = xin;
-    ch.zh = (xin - 1 + q) % q;
-
-    std::vector<uint256> L;
-    uint256 w = 1;
-    uint256 n = domain_size;
-    for (int i = 0; i < std::max(1, public_inputs_size); ++i) {
-        uint256 f0 = mulmod(w, ch.zh, q);
-        uint256 f1 = mulmod(n, (ch.xi - w + q) % q, q);
-        uint256 inv = modinv(f1, q);
-        uint256 l = mulmod(f0, inv, q);
-        L.push_back(l);
-        w = mulmod(w, w1, q);
+    ch.xin = withdraw_domain::pow_n(ch.xi);
+    ch.zh = ch.xin - Fr::one();
+
+    // The last slot holds zh.
+    Fr den[PUBLIC + 1];
+    Fr scratch[PUBLIC + 1];
+    withdraw_domain::lagrange_denominators(ch.xi, den);
+    den[PUBLIC] = ch.zh;
+
+    if (!field::batch_inverse(den, PUBLIC + 1, scratch)) {
+        return false;
     }
-    return L;
+
+    withdraw_domain::lagrange(ch.zh, den, L);
+    ch.zh_inv = den[PUBLIC];
+    return true;
 }
 
-uint256
-calculate_pl(const std::vector<std::vector<char>>& public_inputs,
-             const std::vector<uint256>& L)
+Fr
+calculate_pl(const withdraw_inputs& public_inputs, const Fr L[PUBLIC])
 {
-    uint256 pl = 0;
-    for (int i = 0; i < public_inputs.size(); ++i) {
-        const uint256 w =
-          be::unsafe::load<uint256>((const uint8_t*)public_inputs[i].data());
-        pl = (pl - mulmod(w, L[i], q) + q) % q;
+    fr_acc pl;
+    for (int i = 0; i < PUBLIC; ++i) {
+        const Fr w = Fr::load((const uint8_t*)public_inputs[i].data());
+        pl.mac(w, L[i]);
     }
 
-    return pl;
+    return -pl.reduce();
 }
 
-uint256
-calculate_t(const proof_t& proof,
-            const challenges_t& ch,
-            uint256 pl,
-            uint256 l0)
+Fr
+calculate_t(const proof_t& proof, const challenges_t& ch, Fr pl, Fr l0)
 {
-    uint256 num = proof.eval_r;
-    num = num + pl;
-
-    uint256 e1 = proof.eval_a;
-    e1 = e1 + mulmod(ch.beta, proof.eval_s1, q);
-    e1 = (e1 + ch.gamma) % q;
-
-    uint256 e2 = proof.eval_b;
-    e2 = e2 + mulmod(ch.beta, proof.eval_s2, q);
-    e2 = (e2 + ch.gamma) % q;
-
-    uint256 e3 = proof.eval_c;
-    e3 = (e3 + ch.gamma) % q;
-
-    uint256 e = mulmod(mulmod(e1, e2, q), e3, q);
-    e = mulmod(e, proof.eval_zw, q);
-    e = mulmod(e, ch.alpha, q);
-
-    num = (num - e + q) % q;
-    num = (num - mulmod(l0, mulmod(ch.alpha, ch.alpha, q), q) + q) % q;
-
-    return mulmod(num, modinv(ch.zh, q), q);
+    const Fr e1 = proof.eval_a + ch.beta * proof.eval_s1 + ch.gamma;
+    const Fr e2 = proof.eval_b + ch.beta * proof.eval_s2 + ch.gamma;
+    const Fr e3 = proof.eval_c + ch.gamma;
+
+    // num = eval_r + pl - e1 * e2 * e3 * eval_zw * alpha - l0 * alpha^2
+    const Fr num = fr_acc()
+                   .add(proof.eval_r)
+                   .add(pl)
+                   .mac(-(e1 * e2 * e3 * proof.eval_zw), ch.alpha)
+                   .mac(-l0, ch.alpha.square())
+                   .reduce();
+
+    return num * ch.zh_inv;
 }
 
-eosio::g1_point
-calculate_D(const proof_t& proof, const challenges_t& ch, uint256 l0)
+// B1 of the pairing check as scalars over fixed bases, so that several
+// proofs can be combined before any point arithmetic is done.
+//
+// The bases from the verification key are shared by all proofs, and G1
+// carries -E. The bases from the proof are its own commitments. A1 is
+// Wxi + a1_wxiw * Wxiw.
+enum
 {
-    eosio::bigint buf(32);
-
-    uint256 s1 = mulmod(mulmod(proof.eval_a, proof.eval_b, q), ch.v[0], q);
-
-    auto res = g1_mul(Qm, s1);
-
-    const uint256 s2 = mulmod(proof.eval_a, ch.v[0], q);
-    res = g1_add(res, g1_mul(Ql, s2));
-
-    const uint256 s3 = mulmod(proof.eval_b, ch.v[0], q);
-    res = g1_add(res, g1_mul(Qr, s3));
-
-    const uint256 s4 = mulmod(proof.eval_c, ch.v[0], q);
-    res = g1_add(res, g1_mul(Qo, s4));
-
-    res = g1_add(res, g1_mul(Qc, ch.v[0]));
+    VK_QM,
+    VK_QL,
+    VK_QR,
+    VK_QO,
+    VK_QC,
+    VK_S1,
+    VK_S2,
+    VK_S3,
+    VK_G1,
+    VK_BASES
+};
+
+enum
+{
+    PROOF_T1,
+    PROOF_T2,
+    PROOF_T3,
+    PROOF_A,
+    PROOF_B,
+    PROOF_C,
+    PROOF_Z,
+    PROOF_WXI,
+    PROOF_WXIW,
+    PROOF_BASES
+};
 
-    const uint256 beta_xi = mulmod(ch.beta, ch.xi, q);
-    const uint256 s6a = addmod(addmod(proof.eval_a, beta_xi, q), ch.gamma, q);
-    const uint256 s6b =
-      addmod(addmod(proof.eval_b, mulmod(beta_xi, k1, q), q), ch.gamma, q);
-    const uint256 s6c =
-      addmod(addmod(proof.eval_c, mulmod(beta_xi, k2, q), q), ch.gamma, q);
-    const uint256 s6d =
-      mulmod(mulmod(l0, mulmod(ch.alpha, ch.alpha, q), q), ch.v[0], q);
+typedef struct
+{
+    Fr vk[VK_BASES];
+    Fr proof[PROOF_BASES];
+    Fr a1_wxiw;
+} pairing_scalars_t;
 
-    uint256 s6 = mulmod(
-      mulmod(s6a, mulmod(s6b, s6c, q), q), mulmod(ch.alpha, ch.v[0], q), q);
-    s6 = addmod(s6, s6d, q);
-    s6 = addmod(s6, ch.u, q);
+constexpr g1_data_t vk_bases[VK_BASES] = { Qm, Ql, Qr, Qo, Qc,
+                                           S1, S2, S3, G1_data };
 
-    res = g1_add(res, g1_mul(proof.Z, s6));
+static void
+get_proof_bases(const withdraw_proof& data, const char* bases[])
+{
+    bases[PROOF_T1] = data.T1.data();
+    bases[PROOF_T2] = data.T2.data();
+    bases[PROOF_T3] = data.T3.data();
+    bases[PROOF_A] = data.A.data();
+    bases[PROOF_B] = data.B.data();
+    bases[PROOF_C] = data.C.data();
+    bases[PROOF_Z] = data.Z.data();
+    bases[PROOF_WXI] = data.Wxi.data();
+    bases[PROOF_WXIW] = data.Wxiw.data();
+}
 
-    const uint256 s7a = addmod(
-      addmod(proof.eval_a, mulmod(ch.beta, proof.eval_s1, q), q), ch.gamma, q);
-    const uint256 s7b = addmod(
-      addmod(proof.eval_b, mulmod(ch.beta, proof.eval_s2, q), q), ch.gamma, q);
+void
+calculate_D(const proof_t& proof,
+            const challenges_t& ch,
+            Fr l0,
+            pairing_scalars_t& sc)
+{
+    sc.vk[VK_QM] = proof.eval_a * proof.eval_b * ch.v[0];
+    sc.vk[VK_QL] = proof.eval_a * ch.v[0];
+    sc.vk[VK_QR] = proof.eval_b * ch.v[0];
+    sc.vk[VK_QO] = proof.eval_c * ch.v[0];
+    sc.vk[VK_QC] = ch.v[0];
+
+    const Fr beta_xi = ch.beta * ch.xi;
+    const Fr s6a = proof.eval_a + beta_xi + ch.gamma;
+    const Fr s6b = proof.eval_b + beta_xi * k1 + ch.gamma;
+    const Fr s6c = proof.eval_c + beta_xi * k2 + ch.gamma;
+
+    // s6 = s6a * s6b * s6c * alpha * v0 + l0 * alpha^2 * v0 + u
+    sc.proof[PROOF_Z] = fr_acc()
+                          .mac(s6a * s6b * s6c, ch.alpha * ch.v[0])
+                          .mac(l0 * ch.alpha.square(), ch.v[0])
+                          .add(ch.u)
+                          .reduce();
+
+    const Fr s7a = proof.eval_a + ch.beta * proof.eval_s1 + ch.gamma;
+    const Fr s7b = proof.eval_b + ch.beta * proof.eval_s2 + ch.gamma;
+
+    // The S3 term is subtracted, so its scalar is negated in Fr instead.
+    const Fr s7 = s7a * s7b * ch.alpha * ch.v[0] * ch.beta * proof.eval_zw;
+    sc.vk[VK_S3] = -s7;
+}
 
-    uint256 s7 = mulmod(s7a, s7b, q);
-    s7 = mulmod(s7, ch.alpha, q);
-    s7 = mulmod(s7, ch.v[0], q);
-    s7 = mulmod(s7, ch.beta, q);
-    s7 = mulmod(s7, proof.eval_zw, q);
-    auto S3s7 = g1_mul(S3, s7);
-    res = g1_add(res, g1_neg(S3s7));
+void
+calculate_F(const challenges_t& ch, pairing_scalars_t& sc)
+{
+    sc.proof[PROOF_T1] = Fr::one();
+    sc.proof[PROOF_T2] = ch.xin;
+    sc.proof[PROOF_T3] = ch.xin.square();
+    sc.proof[PROOF_A] = ch.v[1];
+    sc.proof[PROOF_B] = ch.v[2];
+    sc.proof[PROOF_C] = ch.v[3];
+    sc.vk[VK_S1] = ch.v[4];
+    sc.vk[VK_S2] = ch.v[5];
+}
 
-    return res;
+// -E = -s * G1
+void
+calculate_e(const proof_t& proof,
+            const challenges_t& ch,
+            Fr t,
+            pairing_scalars_t& sc)
+{
+    const Fr s = fr_acc()
+                 .add(t)
+                 .mac(ch.v[0], proof.eval_r)
+                 .mac(ch.v[1], proof.eval_a)
+                 .mac(ch.v[2], proof.eval_b)
+                 .mac(ch.v[3], proof.eval_c)
+                 .mac(ch.v[4], proof.eval_s1)
+                 .mac(ch.v[5], proof.eval_s2)
+                 .mac(ch.u, proof.eval_zw)
+                 .reduce();
+
+    sc.vk[VK_G1] = -s;
 }
 
-eosio::g1_point
-calculate_F(const proof_t& proof, const challenges_t& ch, eosio::g1_point D)
+// B1 = F - E + xi * Wxi + u * xi * w * Wxiw, A1 = Wxi + u * Wxiw
+void
+calculate_openings(const challenges_t& ch, pairing_scalars_t& sc)
 {
-    auto res = proof.T1;
-
-    res = g1_add(res, g1_mul(proof.T2, ch.xin));
-    res = g1_add(res, g1_mul(proof.T3, mulmod(ch.xin, ch.xin, q)));
-    res = g1_add(res, D);
-    res = g1_add(res, g1_mul(proof.A, ch.v[1]));
-    res = g1_add(res, g1_mul(proof.B, ch.v[2]));
-    res = g1_add(res, g1_mul(proof.C, ch.v[3]));
-    res = g1_add(res, g1_mul(S1, ch.v[4]));
-    res = g1_add(res, g1_mul(S2, ch.v[5]));
-
-    return res;
+    sc.proof[PROOF_WXI] = ch.xi;
+    sc.proof[PROOF_WXIW] = ch.u * ch.xi * w1;
+    sc.a1_wxiw = ch.u;
 }
 
-eosio::g1_point
-calculate_e(const proof_t& proof, const challenges_t& ch, uint256 t)
+// Everything of one proof but the point arithmetic. Fails if the proof
+// cannot be valid whatever its points, and leaves the challenges in ch.
+bool
+calculate_pairing_scalars(const proof_t& proof,
+                          const withdraw_inputs& public_inputs,
+                          challenges_t& ch,
+                          pairing_scalars_t& sc)
 {
-    auto s = t;
+    {
+        PROFILE_STAGE(STAGE_CHALLENGES);
+        calculate_challenges(proof, public_inputs, ch);
+    }
+    Fr L[PUBLIC];
+    {
+        PROFILE_STAGE(STAGE_LAGRANGE);
+        if (!calculate_lagrange_evaluations(ch, L)) {
+            return false;
+        }
+    }
 
-    s = addmod(s, mulmod(ch.v[0], proof.eval_r, q), q);
-    s = addmod(s, mulmod(ch.v[1], proof.eval_a, q), q);
-    s = addmod(s, mulmod(ch.v[2], proof.eval_b, q), q);
-    s = addmod(s, mulmod(ch.v[3], proof.eval_c, q), q);
-    s = addmod(s, mulmod(ch.v[4], proof.eval_s1, q), q);
-    s = addmod(s, mulmod(ch.v[5], proof.eval_s2, q), q);
-    s = addmod(s, mulmod(ch.u, proof.eval_zw, q), q);
+    PROFILE_STAGE(STAGE_SCALARS);
+    const Fr pl = calculate_pl(public_inputs, L);
+    const Fr t = calculate_t(proof, ch, pl, L[0]);
 
-    auto res = g1_mul(G1, s);
+    calculate_D(proof, ch, L[0], sc);
+    calculate_F(ch, sc);
+    calculate_e(proof, ch, t, sc);
+    calculate_openings(ch, sc);
+    return true;
+}
 
-    return res;
+// e(-A1, X2) * e(B1, G2) == 1
+bool
+isValidPairing(const char* A1, const char* B1)
+{
+    return pairing_check(A1, X2_neg, B1);
 }
 
 bool
-isValidPairing(const proof_t& proof,
-               const challenges_t& ch,
-               eosio::g1_point& E,
-               const eosio::g1_point& F)
+isValidProof(const proof_t& proof, const withdraw_inputs& public_inputs)
 {
-    auto A1 = g1_add(proof.Wxi, g1_mul(proof.Wxiw, ch.u));
+    challenges_t ch;
+    pairing_scalars_t sc;
+    if (!calculate_pairing_scalars(proof, public_inputs, ch, sc)) {
+        return false;
+    }
 
-    auto B1 = g1_mul(proof.Wxi, ch.xi);
-    auto s = mulmod(mulmod(ch.u, ch.xi, q), w1, q);
-    B1 = g1_add(B1, g1_mul(proof.Wxiw, s));
-    B1 = g1_add(B1, F);
-    B1 = g1_add(B1, g1_neg(E));
+    g1_sum A1;
+    g1_sum B1;
+    {
+        PROFILE_STAGE(STAGE_MSM);
+        const char* proof_bases[PROOF_BASES];
+        get_proof_bases(*proof.data, proof_bases);
 
-    std::vector<std::pair<eosio::g1_point, eosio::g2_point>> pairs;
-    pairs.push_back(std::make_pair(g1_neg(A1), X2));
-    pairs.push_back(std::make_pair(B1, G2));
+        A1.add(proof.data->Wxi.data(), Fr::one());
+        A1.add(proof.data->Wxiw.data(), sc.a1_wxiw);
 
-    return eosio::alt_bn128_pair(pairs) == 0;
+        for (int i = 0; i < PROOF_BASES; ++i) {
+            B1.add(proof_bases[i], sc.proof[i]);
+        }
+        for (int i = 0; i < VK_BASES; ++i) {
+            B1.add(vk_bases[i].data(), sc.vk[i]);
+        }
+    }
+
+    PROFILE_STAGE(STAGE_PAIRING);
+    return isValidPairing(A1.get(), B1.get());
 }
 
+// The K pairing checks e(-A1_k, X2) * e(B1_k, G2) == 1 folded into one with
+// random weights r_k = rho^k:
+//   e(-sum r_k A1_k, X2) * e(sum r_k B1_k, G2) == 1
+// rho is chained over the proofs, rho_k = H(rho_{k-1}, challenges of k), and
+// the last one is used. The challenges hash every proof element and public
+// input, so no proof can be chosen after rho is known.
+// A false batch is accepted with probability at most K / q.
+//
+// The weights are folded into the scalars, so the VK bases are multiplied
+// once for the whole batch and each proof only pays for its own points.
 bool
-isValidProof(const proof_t& proof,
-             std::vector<std::vector<char>>& public_inputs)
+isValidProofBatch(const proof_t* proofs,
+                  const withdraw_inputs* const* public_inputs,
+                  size_t count)
 {
-    challenges_t challenges;
-    calculate_challenges(proof, public_inputs, challenges);
-    const auto L =
-      calculate_lagrange_evaluations(challenges, public_inputs.size());
-    uint256 pl = calculate_pl(public_inputs, L);
-    uint256 t = calculate_t(proof, challenges, pl, L[0]);
-    eosio::g1_point D = calculate_D(proof, challenges, L[0]);
-    eosio::g1_point F = calculate_F(proof, challenges, D);
-    eosio::g1_point E = calculate_e(proof, challenges, t);
-
-    return isValidPairing(proof, challenges, E, F);
+    if (count == 0) {
+        return false;
+    }
+
+    std::vector<pairing_scalars_t> sc(count);
+    withdraw_transcript t;
+    Fr rho;
+    for (size_t k = 0; k < count; ++k) {
+        challenges_t ch;
+        if (!calculate_pairing_scalars(
+              proofs[k], *public_inputs[k], ch, sc[k])) {
+            return false;
+        }
+        PROFILE_STAGE(STAGE_CHALLENGES);
+        t.absorb(rho);
+        t.absorb(ch.beta);
+        t.absorb(ch.alpha);
+        t.absorb(ch.xi);
+        t.absorb(ch.v[0]);
+        t.absorb(ch.u);
+        rho = t.squeeze();
+    }
+
+    g1_sum A;
+    g1_sum B;
+    {
+        PROFILE_STAGE(STAGE_MSM);
+        Fr vk_scalars[VK_BASES];
+        Fr r = Fr::one();
+        for (size_t k = 0; k < count; ++k) {
+            const char* proof_bases[PROOF_BASES];
+            get_proof_bases(*proofs[k].data, proof_bases);
+
+            A.add(proofs[k].data->Wxi.data(), r);
+            A.add(proofs[k].data->Wxiw.data(), r * sc[k].a1_wxiw);
+            for (int i = 0; i < PROOF_BASES; ++i) {
+                B.add(proof_bases[i], r * sc[k].proof[i]);
+            }
+            for (int i = 0; i < VK_BASES; ++i) {
+                vk_scalars[i] += r * sc[k].vk[i];
+            }
+            r *= rho;
+        }
+        for (int i = 0; i < VK_BASES; ++i) {
+            B.add(vk_bases[i].data(), vk_scalars[i]);
+        }
+    }
+
+    PROFILE_STAGE(STAGE_PAIRING);
+    return isValidPairing(A.get(), B.get());
 }